@@ -85,6 +85,53 @@ expm1( double x )
 #endif
 }
 
+/** Compute x to the power n by repeated squaring.
+ *  @note Implemented inline for efficiency.
+ */
+inline double
+int_pow( double x, unsigned long n )
+{
+  double result = 1.0;
+  while ( n > 0 )
+  {
+    if ( n & 1 )
+    {
+      result *= x;
+    }
+    x *= x;
+    n >>= 1;
+  }
+  return result;
+}
+
+/** Raise the lower triangular matrix [[a, 0], [b, d]] to the power n by
+ *  repeated squaring. On return, a, b and d hold the elements of the result.
+ *  @note Implemented inline for efficiency.
+ */
+inline void
+triangular_pow( double& a, double& b, double& d, unsigned long n )
+{
+  double result_a = 1.0;
+  double result_b = 0.0;
+  double result_d = 1.0;
+  while ( n > 0 )
+  {
+    if ( n & 1 )
+    {
+      result_b = result_b * a + result_d * b;
+      result_a *= a;
+      result_d *= d;
+    }
+    b *= a + d;
+    a *= a;
+    d *= d;
+    n >>= 1;
+  }
+  a = result_a;
+  b = result_b;
+  d = result_d;
+}
+
 template < typename T >
 bool
 is_nan( T f )
@@ -24,6 +24,7 @@
 #define SORT_H
 
 #include <algorithm>
+#include <cassert>
 #include <cstddef>
 #include <vector>
 
@@ -181,6 +182,103 @@ sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm )
 #endif
 }
 
+/**
+ * Sorts two vectors according to elements in first vector, considering
+ * only the entries from position first onwards.
+ */
+template < typename T1, typename T2 >
+void
+sort( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm, const size_t first )
+{
+  if ( first + 1 >= vec_sort.size() )
+  {
+    return;
+  }
+
+#ifdef HAVE_BOOST
+  boost::sort::spreadsort::integer_sort( make_iterator_pair( vec_sort.begin() + first, vec_perm.begin() + first ),
+    make_iterator_pair( vec_sort.end(), vec_perm.end() ),
+    rightshift_iterator_pair() );
+#else
+  quicksort3way( vec_sort, vec_perm, first, vec_sort.size() - 1 );
+#endif
+}
+
+/**
+ * Merges the sorted ranges [0, first) and [first, size) of vec_sort and
+ * applies the same moves to vec_perm. Entries of the first range that
+ * are not larger than the smallest entry of the second range stay in
+ * place, only the remaining entries are buffered. Equal entries keep
+ * their relative order.
+ */
+template < typename T1, typename T2 >
+void
+merge( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm, const size_t first )
+{
+  const size_t size = vec_sort.size();
+  if ( first == 0 or first >= size or not( vec_sort[ first ] < vec_sort[ first - 1 ] ) )
+  {
+    return;
+  }
+
+  // find first entry of the sorted range that is larger than the
+  // smallest new entry
+  size_t lo = 0;
+  size_t hi = first;
+  while ( lo < hi )
+  {
+    const size_t mid = lo + ( hi - lo ) / 2;
+    if ( vec_sort[ first ] < vec_sort[ mid ] )
+    {
+      hi = mid;
+    }
+    else
+    {
+      lo = mid + 1;
+    }
+  }
+
+  std::vector< T1 > buffer_sort( vec_sort.begin() + lo, vec_sort.begin() + first );
+  std::vector< T2 > buffer_perm( vec_perm.begin() + lo, vec_perm.begin() + first );
+
+  // the write position never overtakes the read position in the
+  // second range, as long as buffered entries remain
+  size_t out = lo;
+  size_t i = 0;
+  size_t j = first;
+  while ( i < buffer_sort.size() )
+  {
+    if ( j < size and vec_sort[ j ] < buffer_sort[ i ] )
+    {
+      vec_sort[ out ] = vec_sort[ j ];
+      vec_perm[ out ] = vec_perm[ j ];
+      ++j;
+    }
+    else
+    {
+      vec_sort[ out ] = buffer_sort[ i ];
+      vec_perm[ out ] = buffer_perm[ i ];
+      ++i;
+    }
+    ++out;
+  }
+}
+
+/**
+ * Sorts two vectors according to elements in first vector, assuming
+ * that the first num_sorted entries are already sorted. Only the
+ * remaining entries are sorted, and are then merged with the sorted
+ * ones.
+ */
+template < typename T1, typename T2 >
+void
+sort_incrementally( BlockVector< T1 >& vec_sort, BlockVector< T2 >& vec_perm, const size_t num_sorted )
+{
+  assert( vec_sort.size() == vec_perm.size() );
+  sort( vec_sort, vec_perm, num_sorted );
+  merge( vec_sort, vec_perm, num_sorted );
+}
+
 } // namespace sort
 
 #endif /* #ifndef SORT_H */
@@ -23,8 +23,6 @@
 
 #include "hh_psc_alpha.h"
 
-#ifdef HAVE_GSL
-
 // C++ includes:
 #include <cstdio>
 #include <iomanip>
@@ -66,15 +64,14 @@ RecordablesMap< hh_psc_alpha >::create()
   insert_( names::Act_n, &hh_psc_alpha::get_y_elem_< hh_psc_alpha::State_::HH_N > );
 }
 
-extern "C" int
-hh_psc_alpha_dynamics( double, const double y[], double f[], void* pnode )
+inline void
+nest::hh_psc_alpha::Dynamics_::operator()( const double y[], double f[] ) const
 {
   // a shorthand
   typedef nest::hh_psc_alpha::State_ S;
 
   // get access to node so we can almost work as in a member function
-  assert( pnode );
-  const nest::hh_psc_alpha& node = *( reinterpret_cast< nest::hh_psc_alpha* >( pnode ) );
+  const nest::hh_psc_alpha& node = node_;
 
   // y[] here is---and must be---the state vector supplied by the integrator,
   // not the state vector in the node, node.S_.y[].
@@ -116,8 +113,6 @@ hh_psc_alpha_dynamics( double, const double y[], double f[], void* pnode )
   f[ S::I_EXC ] = dI_ex - ( I_ex / node.P_.tau_synE );
   f[ S::DI_INH ] = -dI_in / node.P_.tau_synI;
   f[ S::I_INH ] = dI_in - ( I_in / node.P_.tau_synI );
-
-  return GSL_SUCCESS;
 }
 }
 
@@ -260,9 +255,7 @@ nest::hh_psc_alpha::State_::set( const DictionaryDatum& d )
 
 nest::hh_psc_alpha::Buffers_::Buffers_( hh_psc_alpha& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , integrator_( 1e-3, 0.0 )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -270,16 +263,14 @@ nest::hh_psc_alpha::Buffers_::Buffers_( hh_psc_alpha& n )
 
 nest::hh_psc_alpha::Buffers_::Buffers_( const Buffers_&, hh_psc_alpha& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , integrator_( 1e-3, 0.0 )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
 /* ----------------------------------------------------------------
- * Default and copy constructor for node, and destructor
+ * Default and copy constructor for node
  * ---------------------------------------------------------------- */
 
 nest::hh_psc_alpha::hh_psc_alpha()
@@ -299,23 +290,6 @@ nest::hh_psc_alpha::hh_psc_alpha( const hh_psc_alpha& n )
 {
 }
 
-nest::hh_psc_alpha::~hh_psc_alpha()
-{
-  // GSL structs may not have been allocated, so we need to protect destruction
-  if ( B_.s_ )
-  {
-    gsl_odeiv_step_free( B_.s_ );
-  }
-  if ( B_.c_ )
-  {
-    gsl_odeiv_control_free( B_.c_ );
-  }
-  if ( B_.e_ )
-  {
-    gsl_odeiv_evolve_free( B_.e_ );
-  }
-}
-
 /* ----------------------------------------------------------------
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -340,38 +314,6 @@ nest::hh_psc_alpha::init_buffers_()
   B_.step_ = Time::get_resolution().get_ms();
   B_.IntegrationStep_ = B_.step_;
 
-  if ( B_.s_ == 0 )
-  {
-    B_.s_ = gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_step_reset( B_.s_ );
-  }
-
-  if ( B_.c_ == 0 )
-  {
-    B_.c_ = gsl_odeiv_control_y_new( 1e-3, 0.0 );
-  }
-  else
-  {
-    gsl_odeiv_control_init( B_.c_, 1e-3, 0.0, 1.0, 0.0 );
-  }
-
-  if ( B_.e_ == 0 )
-  {
-    B_.e_ = gsl_odeiv_evolve_alloc( State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_evolve_reset( B_.e_ );
-  }
-
-  B_.sys_.function = hh_psc_alpha_dynamics;
-  B_.sys_.jacobian = NULL;
-  B_.sys_.dimension = State_::STATE_VEC_SIZE;
-  B_.sys_.params = reinterpret_cast< void* >( this );
-
   B_.I_stim_ = 0.0;
 }
 
@@ -402,35 +344,15 @@ nest::hh_psc_alpha::update( Time const& origin, const long from, const long to )
   for ( long lag = from; lag < to; ++lag )
   {
 
-    double t = 0.0;
     const double U_old = S_.y_[ State_::V_M ];
 
-    // numerical integration with adaptive step size control:
-    // ------------------------------------------------------
-    // gsl_odeiv_evolve_apply performs only a single numerical
-    // integration step, starting from t and bounded by step;
-    // the while-loop ensures integration over the whole simulation
-    // step (0, step] if more than one integration step is needed due
-    // to a small integration step size;
-    // note that (t+IntegrationStep > step) leads to integration over
-    // (t, step] and afterwards setting t to step, but it does not
-    // enforce setting IntegrationStep to step-t; this is of advantage
-    // for a consistent and efficient integration across subsequent
-    // simulation intervals
-    while ( t < B_.step_ )
+    // numerical integration with adaptive step size control over the
+    // whole simulation step (0, step]; the integration step size is
+    // kept across simulation steps, the last integration step of each
+    // simulation step is shortened to end at step without changing it
+    if ( not B_.integrator_.integrate( Dynamics_( *this ), B_.step_, B_.IntegrationStep_, S_.y_ ) )
     {
-      const int status = gsl_odeiv_evolve_apply( B_.e_,
-        B_.c_,
-        B_.s_,
-        &B_.sys_,             // system of ODE
-        &t,                   // from t
-        B_.step_,             // to t <= step
-        &B_.IntegrationStep_, // integration step size
-        S_.y_ );              // neuronal state
-      if ( status != GSL_SUCCESS )
-      {
-        throw GSLSolverFailure( get_name(), status );
-      }
+      throw NumericalInstability( get_name() );
     }
 
     S_.y_[ State_::DI_EXC ] += B_.spike_exc_.get_value( lag ) * V_.PSCurrInit_E_;
@@ -496,5 +418,3 @@ nest::hh_psc_alpha::handle( DataLoggingRequest& e )
 {
   B_.logger_.handle( e );
 }
-
-#endif // HAVE_GSL
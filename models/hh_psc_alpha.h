@@ -23,20 +23,10 @@
 #ifndef HH_PSC_ALPHA_H
 #define HH_PSC_ALPHA_H
 
-// Generated includes:
-#include "config.h"
-
-#ifdef HAVE_GSL
-
-// External includes:
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_odeiv.h>
-#include <gsl/gsl_sf_exp.h>
-
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
+#include "dormand_prince.h"
 #include "event.h"
 #include "nest_types.h"
 #include "recordables_map.h"
@@ -45,18 +35,6 @@
 
 namespace nest
 {
-/**
- * Function computing right-hand side of ODE for GSL solver.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int hh_psc_alpha_dynamics( double, const double*, double*, void* );
-
 /** @BeginDocumentation
 @ingroup Neurons
 @ingroup hh
@@ -80,6 +58,10 @@ Spike detection is done by a combined threshold-and-local-maximum search: if
 there is a local maximum above a certain threshold of the membrane potential,
 it is considered a spike.
 
+3. Integration
+The dynamics are integrated with the adaptive Dormand-Prince method of order
+5(4) built into NEST, so the model does not require the GSL.
+
 Parameters:
 
 The following parameters can be set in the status dictionary.
@@ -135,7 +117,6 @@ class hh_psc_alpha : public Archiving_Node
 public:
   hh_psc_alpha();
   hh_psc_alpha( const hh_psc_alpha& );
-  ~hh_psc_alpha();
 
   /**
    * Import sets of overloaded virtual functions.
@@ -168,9 +149,6 @@ private:
 
   // Friends --------------------------------------------------------
 
-  // make dynamics function quasi-member
-  friend int hh_psc_alpha_dynamics( double, const double*, double*, void* );
-
   // The next two classes need to be friend to access the State_ class/member
   friend class RecordablesMap< hh_psc_alpha >;
   friend class UniversalDataLogger< hh_psc_alpha >;
@@ -212,7 +190,7 @@ public:
 
     /**
      * Enumeration identifying elements in state array State_::y_.
-     * The state vector must be passed to GSL as a C array. This enum
+     * The state vector must be passed to the solver as a C array. This enum
      * identifies the elements of the vector. It must be public to be
      * accessible from the iteration function.
      */
@@ -230,7 +208,7 @@ public:
     };
 
 
-    //! neuron state, must be C-array for GSL solver
+    //! neuron state, must be C-array for the ODE solver
     double y_[ STATE_VEC_SIZE ];
     int r_; //!< number of refractory steps remaining
 
@@ -261,18 +239,15 @@ private:
     RingBuffer spike_inh_;
     RingBuffer currents_;
 
-    /** GSL ODE stuff */
-    gsl_odeiv_step* s_;    //!< stepping function
-    gsl_odeiv_control* c_; //!< adaptive stepsize control function
-    gsl_odeiv_evolve* e_;  //!< evolution function
-    gsl_odeiv_system sys_; //!< struct describing system
+    //! ODE solver with adaptive step size control
+    DormandPrince< State_::STATE_VEC_SIZE > integrator_;
 
     // IntergrationStep_ should be reset with the neuron on ResetNetwork,
     // but remain unchanged during calibration. Since it is initialized with
     // step_, and the resolution cannot change after nodes have been created,
     // it is safe to place both here.
     double step_;            //!< step size in ms
-    double IntegrationStep_; //!< current integration time step, updated by GSL
+    double IntegrationStep_; //!< current integration time step, updated by solver
 
     /**
      * Input current injected by CurrentEvent.
@@ -284,6 +259,21 @@ private:
     double I_stim_;
   };
 
+  /**
+   * Right-hand side of the ODE system, inlined into the solver.
+   */
+  struct Dynamics_
+  {
+    explicit Dynamics_( const hh_psc_alpha& node )
+      : node_( node )
+    {
+    }
+
+    void operator()( const double y[], double f[] ) const;
+
+    const hh_psc_alpha& node_;
+  };
+
   // ----------------------------------------------------------------
 
   /**
@@ -393,5 +383,4 @@ hh_psc_alpha::set_status( const DictionaryDatum& d )
 
 } // namespace
 
-#endif // HAVE_GSL
 #endif // HH_PSC_ALPHA_H
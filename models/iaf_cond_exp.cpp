@@ -22,8 +22,6 @@
 
 #include "iaf_cond_exp.h"
 
-#ifdef HAVE_GSL
-
 // C++ includes:
 #include <cstdio>
 #include <iomanip>
@@ -66,15 +64,14 @@ RecordablesMap< iaf_cond_exp >::create()
 }
 }
 
-extern "C" inline int
-nest::iaf_cond_exp_dynamics( double, const double y[], double f[], void* pnode )
+inline void
+nest::iaf_cond_exp::Dynamics_::operator()( const double y[], double f[] ) const
 {
   // a shorthand
   typedef nest::iaf_cond_exp::State_ S;
 
   // get access to node so we can almost work as in a member function
-  assert( pnode );
-  const nest::iaf_cond_exp& node = *( reinterpret_cast< nest::iaf_cond_exp* >( pnode ) );
+  const nest::iaf_cond_exp& node = node_;
 
   // y[] here is---and must be---the state vector supplied by the integrator,
   // not the state vector in the node, node.S_.y[].
@@ -90,8 +87,6 @@ nest::iaf_cond_exp_dynamics( double, const double y[], double f[], void* pnode )
 
   f[ 1 ] = -y[ S::G_EXC ] / node.P_.tau_synE;
   f[ 2 ] = -y[ S::G_INH ] / node.P_.tau_synI;
-
-  return GSL_SUCCESS;
 }
 
 /* ----------------------------------------------------------------
@@ -211,9 +206,7 @@ nest::iaf_cond_exp::State_::set( const DictionaryDatum& d, const Parameters_& )
 
 nest::iaf_cond_exp::Buffers_::Buffers_( iaf_cond_exp& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , integrator_( 1e-3, 0.0 )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
@@ -221,16 +214,14 @@ nest::iaf_cond_exp::Buffers_::Buffers_( iaf_cond_exp& n )
 
 nest::iaf_cond_exp::Buffers_::Buffers_( const Buffers_&, iaf_cond_exp& n )
   : logger_( n )
-  , s_( 0 )
-  , c_( 0 )
-  , e_( 0 )
+  , integrator_( 1e-3, 0.0 )
 {
   // Initialization of the remaining members is deferred to
   // init_buffers_().
 }
 
 /* ----------------------------------------------------------------
- * Default and copy constructor for node, and destructor
+ * Default and copy constructor for node
  * ---------------------------------------------------------------- */
 
 nest::iaf_cond_exp::iaf_cond_exp()
@@ -250,23 +241,6 @@ nest::iaf_cond_exp::iaf_cond_exp( const iaf_cond_exp& n )
 {
 }
 
-nest::iaf_cond_exp::~iaf_cond_exp()
-{
-  // GSL structs may not have been allocated, so we need to protect destruction
-  if ( B_.s_ )
-  {
-    gsl_odeiv_step_free( B_.s_ );
-  }
-  if ( B_.c_ )
-  {
-    gsl_odeiv_control_free( B_.c_ );
-  }
-  if ( B_.e_ )
-  {
-    gsl_odeiv_evolve_free( B_.e_ );
-  }
-}
-
 /* ----------------------------------------------------------------
  * Node initialization functions
  * ---------------------------------------------------------------- */
@@ -291,38 +265,6 @@ nest::iaf_cond_exp::init_buffers_()
   B_.step_ = Time::get_resolution().get_ms();
   B_.IntegrationStep_ = B_.step_;
 
-  if ( B_.s_ == 0 )
-  {
-    B_.s_ = gsl_odeiv_step_alloc( gsl_odeiv_step_rkf45, State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_step_reset( B_.s_ );
-  }
-
-  if ( B_.c_ == 0 )
-  {
-    B_.c_ = gsl_odeiv_control_y_new( 1e-3, 0.0 );
-  }
-  else
-  {
-    gsl_odeiv_control_init( B_.c_, 1e-3, 0.0, 1.0, 0.0 );
-  }
-
-  if ( B_.e_ == 0 )
-  {
-    B_.e_ = gsl_odeiv_evolve_alloc( State_::STATE_VEC_SIZE );
-  }
-  else
-  {
-    gsl_odeiv_evolve_reset( B_.e_ );
-  }
-
-  B_.sys_.function = iaf_cond_exp_dynamics;
-  B_.sys_.jacobian = NULL;
-  B_.sys_.dimension = State_::STATE_VEC_SIZE;
-  B_.sys_.params = reinterpret_cast< void* >( this );
-
   B_.I_stim_ = 0.0;
 }
 
@@ -351,34 +293,14 @@ nest::iaf_cond_exp::update( Time const& origin, const long from, const long to )
   for ( long lag = from; lag < to; ++lag )
   {
 
-    double t = 0.0;
-
-    // numerical integration with adaptive step size control:
-    // ------------------------------------------------------
-    // gsl_odeiv_evolve_apply performs only a single numerical
-    // integration step, starting from t and bounded by step;
-    // the while-loop ensures integration over the whole simulation
-    // step (0, step] if more than one integration step is needed due
-    // to a small integration step size;
-    // note that (t+IntegrationStep > step) leads to integration over
-    // (t, step] and afterwards setting t to step, but it does not
-    // enforce setting IntegrationStep to step-t; this is of advantage
-    // for a consistent and efficient integration across subsequent
-    // simulation intervals
-    while ( t < B_.step_ )
+
+    // numerical integration with adaptive step size control over the
+    // whole simulation step (0, step]; the integration step size is
+    // kept across simulation steps, the last integration step of each
+    // simulation step is shortened to end at step without changing it
+    if ( not B_.integrator_.integrate( Dynamics_( *this ), B_.step_, B_.IntegrationStep_, S_.y_ ) )
     {
-      const int status = gsl_odeiv_evolve_apply( B_.e_,
-        B_.c_,
-        B_.s_,
-        &B_.sys_,             // system of ODE
-        &t,                   // from t
-        B_.step_,             // to t <= step
-        &B_.IntegrationStep_, // integration step size
-        S_.y_ );              // neuronal state
-      if ( status != GSL_SUCCESS )
-      {
-        throw GSLSolverFailure( get_name(), status );
-      }
+      throw NumericalInstability( get_name() );
     }
 
     S_.y_[ State_::G_EXC ] += B_.spike_exc_.get_value( lag );
@@ -445,5 +367,3 @@ nest::iaf_cond_exp::handle( DataLoggingRequest& e )
 {
   B_.logger_.handle( e );
 }
-
-#endif // HAVE_GSL
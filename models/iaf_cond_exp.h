@@ -23,19 +23,10 @@
 #ifndef IAF_COND_EXP_H
 #define IAF_COND_EXP_H
 
-// Generated includes:
-#include "config.h"
-
-#ifdef HAVE_GSL
-
-// External includes:
-#include <gsl/gsl_errno.h>
-#include <gsl/gsl_matrix.h>
-#include <gsl/gsl_odeiv.h>
-
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
+#include "dormand_prince.h"
 #include "event.h"
 #include "nest_types.h"
 #include "recordables_map.h"
@@ -44,18 +35,6 @@
 
 namespace nest
 {
-/**
- * Function computing right-hand side of ODE for GSL solver.
- * @note Must be declared here so we can befriend it in class.
- * @note Must have C-linkage for passing to GSL. Internally, it is
- *       a first-class C++ function, but cannot be a member function
- *       because of the C-linkage.
- * @note No point in declaring it inline, since it is called
- *       through a function pointer.
- * @param void* Pointer to model neuron instance.
- */
-extern "C" int iaf_cond_exp_dynamics( double, const double*, double*, void* );
-
 /** @BeginDocumentation
 @ingroup Neurons
 @ingroup iaf
@@ -72,6 +51,9 @@ of conductance modelled by an exponential function. The exponential function
 is normalised such that an event of weight 1.0 results in a peak conductance of
 1 nS.
 
+The dynamics are integrated with the adaptive Dormand-Prince method of order
+5(4) built into NEST, so the model does not require the GSL.
+
 Parameters:
 
 The following parameters can be set in the status dictionary.
@@ -116,7 +98,6 @@ class iaf_cond_exp : public Archiving_Node
 public:
   iaf_cond_exp();
   iaf_cond_exp( const iaf_cond_exp& );
-  ~iaf_cond_exp();
 
   /**
    * Import sets of overloaded virtual functions.
@@ -149,9 +130,6 @@ private:
 
   // Friends --------------------------------------------------------
 
-  // make dynamics function quasi-member
-  friend int iaf_cond_exp_dynamics( double, const double*, double*, void* );
-
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_cond_exp >;
   friend class UniversalDataLogger< iaf_cond_exp >;
@@ -200,7 +178,7 @@ public:
       STATE_VEC_SIZE
     };
 
-    //! neuron state, must be C-array for GSL solver
+    //! neuron state, must be C-array for the ODE solver
     double y_[ STATE_VEC_SIZE ];
     int r_; //!< number of refractory steps remaining
 
@@ -231,18 +209,15 @@ private:
     RingBuffer spike_inh_;
     RingBuffer currents_;
 
-    /** GSL ODE stuff */
-    gsl_odeiv_step* s_;    //!< stepping function
-    gsl_odeiv_control* c_; //!< adaptive stepsize control function
-    gsl_odeiv_evolve* e_;  //!< evolution function
-    gsl_odeiv_system sys_; //!< struct describing system
+    //! ODE solver with adaptive step size control
+    DormandPrince< State_::STATE_VEC_SIZE > integrator_;
 
     // IntergrationStep_ should be reset with the neuron on ResetNetwork,
     // but remain unchanged during calibration. Since it is initialized with
     // step_, and the resolution cannot change after nodes have been created,
     // it is safe to place both here.
     double step_;            //!< step size in ms
-    double IntegrationStep_; //!< current integration time step, updated by GSL
+    double IntegrationStep_; //!< current integration time step, updated by solver
 
     /**
      * Input current injected by CurrentEvent.
@@ -254,6 +229,21 @@ private:
     double I_stim_;
   };
 
+  /**
+   * Right-hand side of the ODE system, inlined into the solver.
+   */
+  struct Dynamics_
+  {
+    explicit Dynamics_( const iaf_cond_exp& node )
+      : node_( node )
+    {
+    }
+
+    void operator()( const double y[], double f[] ) const;
+
+    const iaf_cond_exp& node_;
+  };
+
   // ----------------------------------------------------------------
 
   /**
@@ -356,5 +346,4 @@ iaf_cond_exp::set_status( const DictionaryDatum& d )
 
 } // namespace
 
-#endif // HAVE_GSL
 #endif // IAF_COND_EXP_H
@@ -218,6 +218,8 @@ iaf_psc_alpha::iaf_psc_alpha()
   , P_()
   , S_()
   , B_( *this )
+  , population_( 0 )
+  , population_slot_( 0 )
 {
   recordablesMap_.create();
 }
@@ -227,6 +229,8 @@ iaf_psc_alpha::iaf_psc_alpha( const iaf_psc_alpha& n )
   , P_( n.P_ )
   , S_( n.S_ )
   , B_( n.B_, *this )
+  , population_( 0 )
+  , population_slot_( 0 )
 {
 }
 
@@ -306,6 +310,12 @@ iaf_psc_alpha::calibrate()
   V_.RefractoryCounts_ = Time( Time::ms( P_.TauR_ ) ).get_steps();
   // since t_ref_ >= 0, this can only fail in error
   assert( V_.RefractoryCounts_ >= 0 );
+
+  if ( kernel().node_manager.use_population_update() and not is_frozen() and population_ == 0 )
+  {
+    population_ = &kernel().node_manager.get_population_engine< Population >( get_thread() );
+    population_slot_ = population_->add( *this );
+  }
 }
 
 /* ----------------------------------------------------------------
@@ -318,6 +328,11 @@ iaf_psc_alpha::update( Time const& origin, const long from, const long to )
   assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  if ( population_ )
+  {
+    return; // updated by the population engine
+  }
+
   for ( long lag = from; lag < to; ++lag )
   {
     if ( S_.r_ == 0 )
@@ -410,4 +425,252 @@ iaf_psc_alpha::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
+/* ----------------------------------------------------------------
+ * Population engine
+ * ---------------------------------------------------------------- */
+
+index
+iaf_psc_alpha::Population::add( iaf_psc_alpha& n )
+{
+  nodes_.push_back( &n );
+
+  const size_t size = nodes_.size();
+  I_e_.resize( size );
+  Theta_.resize( size );
+  LowerBound_.resize( size );
+  V_reset_.resize( size );
+  EPSCInitialValue_.resize( size );
+  IPSCInitialValue_.resize( size );
+  RefractoryCounts_.resize( size );
+  P11_ex_.resize( size );
+  P21_ex_.resize( size );
+  P22_ex_.resize( size );
+  P31_ex_.resize( size );
+  P32_ex_.resize( size );
+  P11_in_.resize( size );
+  P21_in_.resize( size );
+  P22_in_.resize( size );
+  P31_in_.resize( size );
+  P32_in_.resize( size );
+  P30_.resize( size );
+  expm1_tau_m_.resize( size );
+  y0_.resize( size );
+  dI_ex_.resize( size );
+  I_ex_.resize( size );
+  dI_in_.resize( size );
+  I_in_.resize( size );
+  y3_.resize( size );
+  r_.resize( size );
+  weighted_spikes_ex_.resize( size );
+  weighted_spikes_in_.resize( size );
+  currents_.resize( size );
+  spiked_.resize( size );
+
+  load( size - 1 );
+  return size - 1;
+}
+
+void
+iaf_psc_alpha::Population::load( const index i )
+{
+  const iaf_psc_alpha& n = *nodes_[ i ];
+
+  I_e_[ i ] = n.P_.I_e_;
+  Theta_[ i ] = n.P_.Theta_;
+  LowerBound_[ i ] = n.P_.LowerBound_;
+  V_reset_[ i ] = n.P_.V_reset_;
+  EPSCInitialValue_[ i ] = n.V_.EPSCInitialValue_;
+  IPSCInitialValue_[ i ] = n.V_.IPSCInitialValue_;
+  RefractoryCounts_[ i ] = n.V_.RefractoryCounts_;
+  P11_ex_[ i ] = n.V_.P11_ex_;
+  P21_ex_[ i ] = n.V_.P21_ex_;
+  P22_ex_[ i ] = n.V_.P22_ex_;
+  P31_ex_[ i ] = n.V_.P31_ex_;
+  P32_ex_[ i ] = n.V_.P32_ex_;
+  P11_in_[ i ] = n.V_.P11_in_;
+  P21_in_[ i ] = n.V_.P21_in_;
+  P22_in_[ i ] = n.V_.P22_in_;
+  P31_in_[ i ] = n.V_.P31_in_;
+  P32_in_[ i ] = n.V_.P32_in_;
+  P30_[ i ] = n.V_.P30_;
+  expm1_tau_m_[ i ] = n.V_.expm1_tau_m_;
+
+  set_state_( i, n.S_ );
+}
+
+iaf_psc_alpha::State_
+iaf_psc_alpha::Population::get_state( const index i ) const
+{
+  State_ s;
+  s.y0_ = y0_[ i ];
+  s.dI_ex_ = dI_ex_[ i ];
+  s.I_ex_ = I_ex_[ i ];
+  s.dI_in_ = dI_in_[ i ];
+  s.I_in_ = I_in_[ i ];
+  s.y3_ = y3_[ i ];
+  s.r_ = static_cast< int >( r_[ i ] );
+  return s;
+}
+
+void
+iaf_psc_alpha::Population::set_state_( const index i, const State_& s )
+{
+  y0_[ i ] = s.y0_;
+  dI_ex_[ i ] = s.dI_ex_;
+  I_ex_[ i ] = s.I_ex_;
+  dI_in_[ i ] = s.dI_in_;
+  I_in_[ i ] = s.I_in_;
+  y3_[ i ] = s.y3_;
+  r_[ i ] = s.r_;
+}
+
+void
+iaf_psc_alpha::Population::store_( const index i )
+{
+  iaf_psc_alpha& n = *nodes_[ i ];
+  n.S_ = get_state( i );
+  n.V_.weighted_spikes_ex_ = weighted_spikes_ex_[ i ];
+  n.V_.weighted_spikes_in_ = weighted_spikes_in_[ i ];
+}
+
+void
+iaf_psc_alpha::Population::detach()
+{
+  for ( index i = 0; i < nodes_.size(); ++i )
+  {
+    store_( i );
+    nodes_[ i ]->population_ = 0;
+  }
+  nodes_.clear();
+}
+
+void
+iaf_psc_alpha::Population::update( Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t size = nodes_.size();
+
+  // frozen neurons are advanced with the others, but their buffers are
+  // not read, they do not spike and their state is restored afterwards
+  frozen_.clear();
+  for ( index i = 0; i < size; ++i )
+  {
+    if ( nodes_[ i ]->is_frozen() )
+    {
+      frozen_.push_back( std::make_pair( i, get_state( i ) ) );
+    }
+  }
+
+  const double* const I_e = &I_e_[ 0 ];
+  const double* const Theta = &Theta_[ 0 ];
+  const double* const LowerBound = &LowerBound_[ 0 ];
+  const double* const V_reset = &V_reset_[ 0 ];
+  const double* const EPSCInitialValue = &EPSCInitialValue_[ 0 ];
+  const double* const IPSCInitialValue = &IPSCInitialValue_[ 0 ];
+  const double* const RefractoryCounts = &RefractoryCounts_[ 0 ];
+  const double* const P11_ex = &P11_ex_[ 0 ];
+  const double* const P21_ex = &P21_ex_[ 0 ];
+  const double* const P22_ex = &P22_ex_[ 0 ];
+  const double* const P31_ex = &P31_ex_[ 0 ];
+  const double* const P32_ex = &P32_ex_[ 0 ];
+  const double* const P11_in = &P11_in_[ 0 ];
+  const double* const P21_in = &P21_in_[ 0 ];
+  const double* const P22_in = &P22_in_[ 0 ];
+  const double* const P31_in = &P31_in_[ 0 ];
+  const double* const P32_in = &P32_in_[ 0 ];
+  const double* const P30 = &P30_[ 0 ];
+  const double* const expm1_tau_m = &expm1_tau_m_[ 0 ];
+  double* const y0 = &y0_[ 0 ];
+  double* const dI_ex = &dI_ex_[ 0 ];
+  double* const I_ex = &I_ex_[ 0 ];
+  double* const dI_in = &dI_in_[ 0 ];
+  double* const I_in = &I_in_[ 0 ];
+  double* const y3 = &y3_[ 0 ];
+  double* const r = &r_[ 0 ];
+  const double* const weighted_spikes_ex = &weighted_spikes_ex_[ 0 ];
+  const double* const weighted_spikes_in = &weighted_spikes_in_[ 0 ];
+  const double* const currents = &currents_[ 0 ];
+  double* const spiked = &spiked_[ 0 ];
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // collect the input of this step from the buffers of the neurons
+    for ( index i = 0; i < size; ++i )
+    {
+      iaf_psc_alpha& n = *nodes_[ i ];
+      if ( n.is_frozen() )
+      {
+        weighted_spikes_ex_[ i ] = weighted_spikes_in_[ i ] = currents_[ i ] = 0.0;
+        continue;
+      }
+      weighted_spikes_ex_[ i ] = n.B_.ex_spikes_.get_value( lag );
+      weighted_spikes_in_[ i ] = n.B_.in_spikes_.get_value( lag );
+      currents_[ i ] = n.B_.currents_.get_value( lag );
+    }
+
+#pragma omp simd
+    for ( size_t i = 0; i < size; ++i )
+    {
+      // evolve the membrane potential if the neuron is not refractory
+      const bool not_refractory = r[ i ] == 0;
+      double y3_new = P30[ i ] * ( y0[ i ] + I_e[ i ] ) + P31_ex[ i ] * dI_ex[ i ] + P32_ex[ i ] * I_ex[ i ]
+        + P31_in[ i ] * dI_in[ i ] + P32_in[ i ] * I_in[ i ] + expm1_tau_m[ i ] * y3[ i ] + y3[ i ];
+
+      // lower bound of membrane potential
+      y3_new = ( y3_new < LowerBound[ i ] ? LowerBound[ i ] : y3_new );
+
+      y3[ i ] = not_refractory ? y3_new : y3[ i ];
+      r[ i ] = not_refractory ? r[ i ] : r[ i ] - 1;
+
+      // alpha shape EPSCs
+      I_ex[ i ] = P21_ex[ i ] * dI_ex[ i ] + P22_ex[ i ] * I_ex[ i ];
+      dI_ex[ i ] *= P11_ex[ i ];
+      dI_ex[ i ] += EPSCInitialValue[ i ] * weighted_spikes_ex[ i ];
+
+      // alpha shape IPSCs
+      I_in[ i ] = P21_in[ i ] * dI_in[ i ] + P22_in[ i ] * I_in[ i ];
+      dI_in[ i ] *= P11_in[ i ];
+      dI_in[ i ] += IPSCInitialValue[ i ] * weighted_spikes_in[ i ];
+
+      // threshold crossing
+      const bool spike = y3[ i ] >= Theta[ i ];
+      r[ i ] = spike ? RefractoryCounts[ i ] : r[ i ];
+      y3[ i ] = spike ? V_reset[ i ] : y3[ i ];
+      spiked[ i ] = spike ? 1.0 : 0.0;
+
+      // set new input current
+      y0[ i ] = currents[ i ];
+    }
+
+    // emit spikes and log state data in the order of the neurons
+    for ( index i = 0; i < size; ++i )
+    {
+      iaf_psc_alpha& n = *nodes_[ i ];
+      if ( n.is_frozen() )
+      {
+        continue;
+      }
+      if ( spiked_[ i ] != 0.0 )
+      {
+        n.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( n, se, lag );
+      }
+      if ( n.B_.logger_.is_connected() )
+      {
+        store_( i );
+        n.B_.logger_.record_data( origin.get_steps() + lag );
+      }
+    }
+  }
+
+  for ( std::vector< std::pair< index, State_ > >::const_iterator it = frozen_.begin(); it != frozen_.end(); ++it )
+  {
+    set_state_( it->first, it->second );
+  }
+}
+
 } // namespace
@@ -23,11 +23,16 @@
 #ifndef IAF_PSC_ALPHA_H
 #define IAF_PSC_ALPHA_H
 
+// C++ includes:
+#include <utility>
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "population_engine.h"
 #include "recordables_map.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
@@ -115,6 +120,9 @@ tau_syn_in, respectively, to avoid numerical instabilities.
 For details, please see IAF_neurons_singularity.ipynb in
 the NEST source code (docs/model_details).
 
+If the kernel property population_update is set, all iaf_psc_alpha
+neurons on a thread are updated together in vectorized loops.
+
 References:
 
 \verbatim embed:rst
@@ -177,6 +185,8 @@ private:
 
   void update( Time const&, const long, const long );
 
+  class Population;
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_alpha >;
   friend class UniversalDataLogger< iaf_psc_alpha >;
@@ -351,10 +361,93 @@ private:
   Buffers_ B_;
   /** @} */
 
+  //! Engine holding the state during simulation, if attached to one
+  Population* population_;
+  index population_slot_; //!< Position in the arrays of the engine
+
   //! Mapping of recordables names to access functions
   static RecordablesMap< iaf_psc_alpha > recordablesMap_;
 };
 
+/**
+ * Population engine for iaf_psc_alpha, see PopulationEngine.
+ *
+ * The loop over the neurons advancing the state by one time step
+ * performs the same operations in the same order as
+ * iaf_psc_alpha::update(), such that the results are identical.
+ */
+class iaf_psc_alpha::Population : public PopulationEngine
+{
+public:
+  /**
+   * Attaches neuron n, loads its state, parameters and propagators and
+   * returns its slot.
+   */
+  index add( iaf_psc_alpha& n );
+
+  /**
+   * Reloads state, parameters and propagators of the neuron in slot i.
+   */
+  void load( const index i );
+
+  /**
+   * Returns the state of the neuron in slot i.
+   */
+  State_ get_state( const index i ) const;
+
+  void update( Time const&, const long, const long );
+  void detach();
+
+private:
+  //! Write the state of the neuron in slot i back to the neuron
+  void store_( const index i );
+
+  //! Overwrite the state of the neuron in slot i
+  void set_state_( const index i, const State_& s );
+
+  std::vector< iaf_psc_alpha* > nodes_;
+
+  // Parameters and propagators
+  std::vector< double > I_e_;
+  std::vector< double > Theta_;
+  std::vector< double > LowerBound_;
+  std::vector< double > V_reset_;
+  std::vector< double > EPSCInitialValue_;
+  std::vector< double > IPSCInitialValue_;
+  std::vector< double > RefractoryCounts_;
+  std::vector< double > P11_ex_;
+  std::vector< double > P21_ex_;
+  std::vector< double > P22_ex_;
+  std::vector< double > P31_ex_;
+  std::vector< double > P32_ex_;
+  std::vector< double > P11_in_;
+  std::vector< double > P21_in_;
+  std::vector< double > P22_in_;
+  std::vector< double > P31_in_;
+  std::vector< double > P32_in_;
+  std::vector< double > P30_;
+  std::vector< double > expm1_tau_m_;
+
+  // State, with the refractory counter stored as double such that all
+  // arrays have the same vector width
+  std::vector< double > y0_;
+  std::vector< double > dI_ex_;
+  std::vector< double > I_ex_;
+  std::vector< double > dI_in_;
+  std::vector< double > I_in_;
+  std::vector< double > y3_;
+  std::vector< double > r_;
+
+  // Input of the current step and whether the neuron spiked
+  std::vector< double > weighted_spikes_ex_;
+  std::vector< double > weighted_spikes_in_;
+  std::vector< double > currents_;
+  std::vector< double > spiked_;
+
+  //! State of frozen neurons, restored at the end of each update
+  std::vector< std::pair< index, State_ > > frozen_;
+};
+
 inline port
 nest::iaf_psc_alpha::send_test_event( Node& target, rport receptor_type, synindex, bool )
 {
@@ -397,7 +490,14 @@ inline void
 iaf_psc_alpha::get_status( DictionaryDatum& d ) const
 {
   P_.get( d );
-  S_.get( d, P_ );
+  if ( population_ )
+  {
+    population_->get_state( population_slot_ ).get( d, P_ );
+  }
+  else
+  {
+    S_.get( d, P_ );
+  }
   Archiving_Node::get_status( d );
 
   ( *d )[ names::recordables ] = recordablesMap_.get_list();
@@ -408,8 +508,9 @@ iaf_psc_alpha::set_status( const DictionaryDatum& d )
 {
   Parameters_ ptmp = P_;                 // temporary copy in case of errors
   const double delta_EL = ptmp.set( d ); // throws if BadProperty
-  State_ stmp = S_;                      // temporary copy in case of errors
-  stmp.set( d, ptmp, delta_EL );         // throws if BadProperty
+  // temporary copy in case of errors
+  State_ stmp = population_ ? population_->get_state( population_slot_ ) : S_;
+  stmp.set( d, ptmp, delta_EL ); // throws if BadProperty
 
   // We now know that (ptmp, stmp) are consistent. We do not
   // write them back to (P_, S_) before we are also sure that
@@ -420,6 +521,10 @@ iaf_psc_alpha::set_status( const DictionaryDatum& d )
   // if we get here, temporaries contain consistent set of properties
   P_ = ptmp;
   S_ = stmp;
+  if ( population_ )
+  {
+    population_->load( population_slot_ );
+  }
 }
 
 } // namespace
@@ -25,6 +25,7 @@
 #include "iaf_psc_delta.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -203,6 +204,8 @@ nest::iaf_psc_delta::iaf_psc_delta()
   , P_()
   , S_()
   , B_( *this )
+  , population_( 0 )
+  , population_slot_( 0 )
 {
   recordablesMap_.create();
 }
@@ -212,6 +215,8 @@ nest::iaf_psc_delta::iaf_psc_delta( const iaf_psc_delta& n )
   , P_( n.P_ )
   , S_( n.S_ )
   , B_( n.B_, *this )
+  , population_( 0 )
+  , population_slot_( 0 )
 {
 }
 
@@ -267,6 +272,15 @@ nest::iaf_psc_delta::calibrate()
   V_.RefractoryCounts_ = Time( Time::ms( P_.t_ref_ ) ).get_steps();
   // since t_ref_ >= 0, this can only fail in error
   assert( V_.RefractoryCounts_ >= 0 );
+
+  // input during the refractory period decays individually and is thus
+  // updated individually
+  if ( kernel().node_manager.use_population_update() and not P_.with_refr_input_ and not is_frozen()
+    and population_ == 0 )
+  {
+    population_ = &kernel().node_manager.get_population_engine< Population >( get_thread() );
+    population_slot_ = population_->add( *this );
+  }
 }
 
 /* ----------------------------------------------------------------
@@ -279,9 +293,27 @@ nest::iaf_psc_delta::update( Time const& origin, const long from, const long to
   assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  if ( population_ )
+  {
+    return; // updated by the population engine
+  }
+
   const double h = Time::get_resolution().get_ms();
+
+  // recording requires every step
+  const bool fast_forward = kernel().node_manager.use_fast_forward() and not B_.logger_.is_connected();
+
   for ( long lag = from; lag < to; ++lag )
   {
+    if ( fast_forward )
+    {
+      lag += fast_forward_( lag, to );
+      if ( lag == to )
+      {
+        break;
+      }
+    }
+
     if ( S_.r_ == 0 )
     {
       // neuron not refractory
@@ -335,6 +367,34 @@ nest::iaf_psc_delta::update( Time const& origin, const long from, const long to
   }
 }
 
+long
+nest::iaf_psc_delta::fast_forward_( const long from, const long to )
+{
+  if ( S_.r_ != 0 or S_.y0_ != 0.0 or S_.refr_spikes_buffer_ != 0.0 )
+  {
+    return 0;
+  }
+
+  long steps = B_.spikes_.get_num_empty_steps( from, to );
+  steps = std::min( steps, B_.currents_.get_num_empty_steps( from, from + steps ) );
+  if ( steps < 2 )
+  {
+    return 0;
+  }
+
+  // without input, the membrane potential relaxes monotonously to V_inf
+  const double V_inf = P_.I_e_ * P_.tau_m_ / P_.c_m_;
+  if ( std::max( S_.y3_, V_inf ) >= P_.V_th_ or std::min( S_.y3_, V_inf ) < P_.V_min_ )
+  {
+    return 0;
+  }
+
+  const double P33 = numerics::int_pow( V_.P33_, steps );
+  S_.y3_ = S_.y3_ * P33 + V_inf * ( 1.0 - P33 );
+
+  return steps;
+}
+
 void
 nest::iaf_psc_delta::handle( SpikeEvent& e )
 {
@@ -366,4 +426,187 @@ nest::iaf_psc_delta::handle( DataLoggingRequest& e )
   B_.logger_.handle( e );
 }
 
+/* ----------------------------------------------------------------
+ * Population engine
+ * ---------------------------------------------------------------- */
+
+nest::index
+nest::iaf_psc_delta::Population::add( iaf_psc_delta& n )
+{
+  nodes_.push_back( &n );
+
+  const size_t size = nodes_.size();
+  I_e_.resize( size );
+  V_th_.resize( size );
+  V_min_.resize( size );
+  V_reset_.resize( size );
+  P30_.resize( size );
+  P33_.resize( size );
+  RefractoryCounts_.resize( size );
+  y0_.resize( size );
+  y3_.resize( size );
+  r_.resize( size );
+  refr_spikes_buffer_.resize( size );
+  spikes_.resize( size );
+  currents_.resize( size );
+  spiked_.resize( size );
+
+  load( size - 1 );
+  return size - 1;
+}
+
+void
+nest::iaf_psc_delta::Population::load( const index i )
+{
+  const iaf_psc_delta& n = *nodes_[ i ];
+
+  I_e_[ i ] = n.P_.I_e_;
+  V_th_[ i ] = n.P_.V_th_;
+  V_min_[ i ] = n.P_.V_min_;
+  V_reset_[ i ] = n.P_.V_reset_;
+  P30_[ i ] = n.V_.P30_;
+  P33_[ i ] = n.V_.P33_;
+  RefractoryCounts_[ i ] = n.V_.RefractoryCounts_;
+
+  set_state_( i, n.S_ );
+}
+
+nest::iaf_psc_delta::State_
+nest::iaf_psc_delta::Population::get_state( const index i ) const
+{
+  State_ s;
+  s.y0_ = y0_[ i ];
+  s.y3_ = y3_[ i ];
+  s.r_ = static_cast< int >( r_[ i ] );
+  s.refr_spikes_buffer_ = refr_spikes_buffer_[ i ];
+  return s;
+}
+
+void
+nest::iaf_psc_delta::Population::set_state_( const index i, const State_& s )
+{
+  y0_[ i ] = s.y0_;
+  y3_[ i ] = s.y3_;
+  r_[ i ] = s.r_;
+  refr_spikes_buffer_[ i ] = s.refr_spikes_buffer_;
+}
+
+void
+nest::iaf_psc_delta::Population::store_( const index i )
+{
+  nodes_[ i ]->S_ = get_state( i );
+}
+
+void
+nest::iaf_psc_delta::Population::detach()
+{
+  for ( index i = 0; i < nodes_.size(); ++i )
+  {
+    store_( i );
+    nodes_[ i ]->population_ = 0;
+  }
+  nodes_.clear();
+}
+
+void
+nest::iaf_psc_delta::Population::update( Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t size = nodes_.size();
+
+  // frozen neurons are advanced with the others, but their buffers are
+  // not read, they do not spike and their state is restored afterwards
+  frozen_.clear();
+  for ( index i = 0; i < size; ++i )
+  {
+    if ( nodes_[ i ]->is_frozen() )
+    {
+      frozen_.push_back( std::make_pair( i, get_state( i ) ) );
+    }
+  }
+
+  const double* const I_e = &I_e_[ 0 ];
+  const double* const V_th = &V_th_[ 0 ];
+  const double* const V_min = &V_min_[ 0 ];
+  const double* const V_reset = &V_reset_[ 0 ];
+  const double* const P30 = &P30_[ 0 ];
+  const double* const P33 = &P33_[ 0 ];
+  const double* const RefractoryCounts = &RefractoryCounts_[ 0 ];
+  double* const y0 = &y0_[ 0 ];
+  double* const y3 = &y3_[ 0 ];
+  double* const r = &r_[ 0 ];
+  const double* const spikes = &spikes_[ 0 ];
+  const double* const currents = &currents_[ 0 ];
+  double* const spiked = &spiked_[ 0 ];
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // collect the input of this step from the buffers of the neurons
+    for ( index i = 0; i < size; ++i )
+    {
+      iaf_psc_delta& n = *nodes_[ i ];
+      if ( n.is_frozen() )
+      {
+        spikes_[ i ] = currents_[ i ] = 0.0;
+        continue;
+      }
+      spikes_[ i ] = n.B_.spikes_.get_value( lag );
+      currents_[ i ] = n.B_.currents_.get_value( lag );
+    }
+
+#pragma omp simd
+    for ( size_t i = 0; i < size; ++i )
+    {
+      // evolve the membrane potential if the neuron is not refractory;
+      // input arriving during the refractory period is discarded
+      const bool not_refractory = r[ i ] == 0;
+      double y3_new = P30[ i ] * ( y0[ i ] + I_e[ i ] ) + P33[ i ] * y3[ i ] + spikes[ i ];
+
+      // lower bound of membrane potential
+      y3_new = ( y3_new < V_min[ i ] ? V_min[ i ] : y3_new );
+
+      y3[ i ] = not_refractory ? y3_new : y3[ i ];
+      r[ i ] = not_refractory ? r[ i ] : r[ i ] - 1;
+
+      // threshold crossing
+      const bool spike = y3[ i ] >= V_th[ i ];
+      r[ i ] = spike ? RefractoryCounts[ i ] : r[ i ];
+      y3[ i ] = spike ? V_reset[ i ] : y3[ i ];
+      spiked[ i ] = spike ? 1.0 : 0.0;
+
+      // set new input current
+      y0[ i ] = currents[ i ];
+    }
+
+    // emit spikes and log state data in the order of the neurons
+    for ( index i = 0; i < size; ++i )
+    {
+      iaf_psc_delta& n = *nodes_[ i ];
+      if ( n.is_frozen() )
+      {
+        continue;
+      }
+      if ( spiked_[ i ] != 0.0 )
+      {
+        n.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( n, se, lag );
+      }
+      if ( n.B_.logger_.is_connected() )
+      {
+        store_( i );
+        n.B_.logger_.record_data( origin.get_steps() + lag );
+      }
+    }
+  }
+
+  for ( std::vector< std::pair< index, State_ > >::const_iterator it = frozen_.begin(); it != frozen_.end(); ++it )
+  {
+    set_state_( it->first, it->second );
+  }
+}
+
 } // namespace
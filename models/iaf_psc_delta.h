@@ -23,11 +23,16 @@
 #ifndef IAF_PSC_DELTA_H
 #define IAF_PSC_DELTA_H
 
+// C++ includes:
+#include <utility>
+#include <vector>
+
 // Includes from nestkernel:
 #include "archiving_node.h"
 #include "connection.h"
 #include "event.h"
 #include "nest_types.h"
+#include "population_engine.h"
 #include "ring_buffer.h"
 #include "universal_data_logger.h"
 
@@ -91,6 +96,11 @@ optimization levels. A future version of iaf_psc_delta will probably
 address the problem of efficient usage of appropriate vector and
 matrix objects.
 
+If the kernel property population_update is set, all iaf_psc_delta
+neurons that discard input during the refractory period on a thread
+are updated together in vectorized loops. Neurons with
+refractory_input are always updated individually.
+
 
 Parameters:
 
@@ -168,6 +178,15 @@ private:
 
   void update( Time const&, const long, const long );
 
+  /**
+   * Advances the neuron over the steps from lag from on, but before to,
+   * in which it receives no input, if it provably does not spike in these
+   * steps. Returns the number of steps.
+   */
+  long fast_forward_( const long from, const long to );
+
+  class Population;
+
   // The next two classes need to be friends to access the State_ class/member
   friend class RecordablesMap< iaf_psc_delta >;
   friend class UniversalDataLogger< iaf_psc_delta >;
@@ -304,10 +323,77 @@ private:
   Buffers_ B_;
   /** @} */
 
+  //! Engine holding the state during simulation, if attached to one
+  Population* population_;
+  index population_slot_; //!< Position in the arrays of the engine
+
   //! Mapping of recordables names to access functions
   static RecordablesMap< iaf_psc_delta > recordablesMap_;
 };
 
+/**
+ * Population engine for iaf_psc_delta, see PopulationEngine.
+ *
+ * The loop over the neurons advancing the state by one time step
+ * performs the same operations in the same order as
+ * iaf_psc_delta::update(), such that the results are identical.
+ */
+class iaf_psc_delta::Population : public PopulationEngine
+{
+public:
+  /**
+   * Attaches neuron n, loads its state, parameters and propagators and
+   * returns its slot.
+   */
+  index add( iaf_psc_delta& n );
+
+  /**
+   * Reloads state, parameters and propagators of the neuron in slot i.
+   */
+  void load( const index i );
+
+  /**
+   * Returns the state of the neuron in slot i.
+   */
+  State_ get_state( const index i ) const;
+
+  void update( Time const&, const long, const long );
+  void detach();
+
+private:
+  //! Write the state of the neuron in slot i back to the neuron
+  void store_( const index i );
+
+  //! Overwrite the state of the neuron in slot i
+  void set_state_( const index i, const State_& s );
+
+  std::vector< iaf_psc_delta* > nodes_;
+
+  // Parameters and propagators
+  std::vector< double > I_e_;
+  std::vector< double > V_th_;
+  std::vector< double > V_min_;
+  std::vector< double > V_reset_;
+  std::vector< double > P30_;
+  std::vector< double > P33_;
+  std::vector< double > RefractoryCounts_;
+
+  // State, with the refractory counter stored as double such that all
+  // arrays have the same vector width
+  std::vector< double > y0_;
+  std::vector< double > y3_;
+  std::vector< double > r_;
+  std::vector< double > refr_spikes_buffer_;
+
+  // Input of the current step and whether the neuron spiked
+  std::vector< double > spikes_;
+  std::vector< double > currents_;
+  std::vector< double > spiked_;
+
+  //! State of frozen neurons, restored at the end of each update
+  std::vector< std::pair< index, State_ > > frozen_;
+};
+
 
 inline port
 nest::iaf_psc_delta::send_test_event( Node& target, rport receptor_type, synindex, bool )
@@ -351,7 +437,14 @@ inline void
 iaf_psc_delta::get_status( DictionaryDatum& d ) const
 {
   P_.get( d );
-  S_.get( d, P_ );
+  if ( population_ )
+  {
+    population_->get_state( population_slot_ ).get( d, P_ );
+  }
+  else
+  {
+    S_.get( d, P_ );
+  }
   Archiving_Node::get_status( d );
   ( *d )[ names::recordables ] = recordablesMap_.get_list();
 }
@@ -361,8 +454,15 @@ iaf_psc_delta::set_status( const DictionaryDatum& d )
 {
   Parameters_ ptmp = P_;                 // temporary copy in case of errors
   const double delta_EL = ptmp.set( d ); // throws if BadProperty
-  State_ stmp = S_;                      // temporary copy in case of errors
-  stmp.set( d, ptmp, delta_EL );         // throws if BadProperty
+  if ( population_ and ptmp.with_refr_input_ )
+  {
+    throw BadProperty(
+      "Refractory input cannot be enabled while the neuron is updated "
+      "by a population engine. Call Cleanup first." );
+  }
+  // temporary copy in case of errors
+  State_ stmp = population_ ? population_->get_state( population_slot_ ) : S_;
+  stmp.set( d, ptmp, delta_EL ); // throws if BadProperty
 
   // We now know that (ptmp, stmp) are consistent. We do not
   // write them back to (P_, S_) before we are also sure that
@@ -373,6 +473,10 @@ iaf_psc_delta::set_status( const DictionaryDatum& d )
   // if we get here, temporaries contain consistent set of properties
   P_ = ptmp;
   S_ = stmp;
+  if ( population_ )
+  {
+    population_->load( population_slot_ );
+  }
 }
 
 } // namespace
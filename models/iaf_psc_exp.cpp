@@ -23,6 +23,7 @@
 #include "iaf_psc_exp.h"
 
 // C++ includes:
+#include <algorithm>
 #include <limits>
 
 // Includes from libnestutil:
@@ -216,6 +217,8 @@ nest::iaf_psc_exp::iaf_psc_exp()
   , P_()
   , S_()
   , B_( *this )
+  , population_( 0 )
+  , population_slot_( 0 )
 {
   recordablesMap_.create();
 }
@@ -225,6 +228,8 @@ nest::iaf_psc_exp::iaf_psc_exp( const iaf_psc_exp& n )
   , P_( n.P_ )
   , S_( n.S_ )
   , B_( n.B_, *this )
+  , population_( 0 )
+  , population_slot_( 0 )
 {
 }
 
@@ -305,6 +310,15 @@ nest::iaf_psc_exp::calibrate()
   assert( V_.RefractoryCounts_ >= 0 );
 
   V_.rng_ = kernel().rng_manager.get_rng( get_thread() );
+
+  // stochastic spiking requires random numbers and is thus updated
+  // individually
+  if ( kernel().node_manager.use_population_update() and P_.delta_ < 1e-10 and not is_frozen()
+    and population_ == 0 )
+  {
+    population_ = &kernel().node_manager.get_population_engine< Population >( get_thread() );
+    population_slot_ = population_->add( *this );
+  }
 }
 
 void
@@ -313,11 +327,29 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
   assert( from < to );
 
+  if ( population_ )
+  {
+    return; // updated by the population engine
+  }
+
   const double h = Time::get_resolution().get_ms();
 
+  // stochastic spiking and recording require every step
+  const bool fast_forward =
+    kernel().node_manager.use_fast_forward() and P_.delta_ < 1e-10 and not B_.logger_.is_connected();
+
   // evolve from timestep 'from' to timestep 'to' with steps of h each
   for ( long lag = from; lag < to; ++lag )
   {
+    if ( fast_forward )
+    {
+      lag += fast_forward_( lag, to );
+      if ( lag == to )
+      {
+        break;
+      }
+    }
+
     if ( S_.r_ref_ == 0 ) // neuron not refractory, so evolve V
     {
       S_.V_m_ =
@@ -365,6 +397,50 @@ nest::iaf_psc_exp::update( const Time& origin, const long from, const long to )
   }
 }
 
+long
+nest::iaf_psc_exp::fast_forward_( const long from, const long to )
+{
+  if ( S_.r_ref_ != 0 or S_.i_0_ != 0.0 or S_.i_1_ != 0.0 )
+  {
+    return 0;
+  }
+
+  long steps = B_.spikes_ex_.get_num_empty_steps( from, to );
+  steps = std::min( steps, B_.spikes_in_.get_num_empty_steps( from, from + steps ) );
+  steps = std::min( steps, B_.currents_[ 0 ].get_num_empty_steps( from, from + steps ) );
+  steps = std::min( steps, B_.currents_[ 1 ].get_num_empty_steps( from, from + steps ) );
+  if ( steps < 2 )
+  {
+    return 0;
+  }
+
+  // Without input, V_m relaxes monotonously to V_inf, and a synaptic
+  // current i_syn raises V_m by less than i_syn * tau_syn / C_m.
+  const double V_inf = P_.I_e_ * P_.Tau_ / P_.C_;
+  const double V_max = std::max( S_.V_m_, V_inf ) + std::max( S_.i_syn_ex_, 0.0 ) * P_.tau_ex_ / P_.C_
+    + std::max( S_.i_syn_in_, 0.0 ) * P_.tau_in_ / P_.C_;
+  if ( V_max >= P_.Theta_ )
+  {
+    return 0;
+  }
+
+  // propagators over all steps
+  double P11ex = V_.P11ex_;
+  double P21ex = V_.P21ex_;
+  double P22 = V_.P22_;
+  numerics::triangular_pow( P11ex, P21ex, P22, steps );
+  double P11in = V_.P11in_;
+  double P21in = V_.P21in_;
+  P22 = V_.P22_;
+  numerics::triangular_pow( P11in, P21in, P22, steps );
+
+  S_.V_m_ = S_.V_m_ * P22 + S_.i_syn_ex_ * P21ex + S_.i_syn_in_ * P21in + V_inf * ( 1.0 - P22 );
+  S_.i_syn_ex_ *= P11ex;
+  S_.i_syn_in_ *= P11in;
+
+  return steps;
+}
+
 void
 nest::iaf_psc_exp::handle( SpikeEvent& e )
 {
@@ -406,3 +482,220 @@ nest::iaf_psc_exp::handle( DataLoggingRequest& e )
 {
   B_.logger_.handle( e );
 }
+
+/* ----------------------------------------------------------------
+ * Population engine
+ * ---------------------------------------------------------------- */
+
+nest::index
+nest::iaf_psc_exp::Population::add( iaf_psc_exp& n )
+{
+  nodes_.push_back( &n );
+
+  const size_t size = nodes_.size();
+  I_e_.resize( size );
+  Theta_.resize( size );
+  V_reset_.resize( size );
+  P20_.resize( size );
+  P11ex_.resize( size );
+  P11in_.resize( size );
+  P21ex_.resize( size );
+  P21in_.resize( size );
+  P22_.resize( size );
+  RefractoryCounts_.resize( size );
+  i_0_.resize( size );
+  i_1_.resize( size );
+  i_syn_ex_.resize( size );
+  i_syn_in_.resize( size );
+  V_m_.resize( size );
+  r_ref_.resize( size );
+  weighted_spikes_ex_.resize( size );
+  weighted_spikes_in_.resize( size );
+  current_0_.resize( size );
+  current_1_.resize( size );
+  spiked_.resize( size );
+
+  load( size - 1 );
+  return size - 1;
+}
+
+void
+nest::iaf_psc_exp::Population::load( const index i )
+{
+  const iaf_psc_exp& n = *nodes_[ i ];
+
+  I_e_[ i ] = n.P_.I_e_;
+  Theta_[ i ] = n.P_.Theta_;
+  V_reset_[ i ] = n.P_.V_reset_;
+  P20_[ i ] = n.V_.P20_;
+  P11ex_[ i ] = n.V_.P11ex_;
+  P11in_[ i ] = n.V_.P11in_;
+  P21ex_[ i ] = n.V_.P21ex_;
+  P21in_[ i ] = n.V_.P21in_;
+  P22_[ i ] = n.V_.P22_;
+  RefractoryCounts_[ i ] = n.V_.RefractoryCounts_;
+
+  set_state_( i, n.S_ );
+}
+
+nest::iaf_psc_exp::State_
+nest::iaf_psc_exp::Population::get_state( const index i ) const
+{
+  State_ s;
+  s.i_0_ = i_0_[ i ];
+  s.i_1_ = i_1_[ i ];
+  s.i_syn_ex_ = i_syn_ex_[ i ];
+  s.i_syn_in_ = i_syn_in_[ i ];
+  s.V_m_ = V_m_[ i ];
+  s.r_ref_ = static_cast< int >( r_ref_[ i ] );
+  return s;
+}
+
+void
+nest::iaf_psc_exp::Population::set_state_( const index i, const State_& s )
+{
+  i_0_[ i ] = s.i_0_;
+  i_1_[ i ] = s.i_1_;
+  i_syn_ex_[ i ] = s.i_syn_ex_;
+  i_syn_in_[ i ] = s.i_syn_in_;
+  V_m_[ i ] = s.V_m_;
+  r_ref_[ i ] = s.r_ref_;
+}
+
+void
+nest::iaf_psc_exp::Population::store_( const index i )
+{
+  iaf_psc_exp& n = *nodes_[ i ];
+  n.S_ = get_state( i );
+  n.V_.weighted_spikes_ex_ = weighted_spikes_ex_[ i ];
+  n.V_.weighted_spikes_in_ = weighted_spikes_in_[ i ];
+}
+
+void
+nest::iaf_psc_exp::Population::detach()
+{
+  for ( index i = 0; i < nodes_.size(); ++i )
+  {
+    store_( i );
+    nodes_[ i ]->population_ = 0;
+  }
+  nodes_.clear();
+}
+
+void
+nest::iaf_psc_exp::Population::update( Time const& origin, const long from, const long to )
+{
+  assert( to >= 0 && ( delay ) from < kernel().connection_manager.get_min_delay() );
+  assert( from < to );
+
+  const size_t size = nodes_.size();
+
+  // frozen neurons are advanced with the others, but their buffers are
+  // not read, they do not spike and their state is restored afterwards
+  frozen_.clear();
+  for ( index i = 0; i < size; ++i )
+  {
+    if ( nodes_[ i ]->is_frozen() )
+    {
+      frozen_.push_back( std::make_pair( i, get_state( i ) ) );
+    }
+  }
+
+  const double* const I_e = &I_e_[ 0 ];
+  const double* const Theta = &Theta_[ 0 ];
+  const double* const V_reset = &V_reset_[ 0 ];
+  const double* const P20 = &P20_[ 0 ];
+  const double* const P11ex = &P11ex_[ 0 ];
+  const double* const P11in = &P11in_[ 0 ];
+  const double* const P21ex = &P21ex_[ 0 ];
+  const double* const P21in = &P21in_[ 0 ];
+  const double* const P22 = &P22_[ 0 ];
+  const double* const RefractoryCounts = &RefractoryCounts_[ 0 ];
+  double* const i_0 = &i_0_[ 0 ];
+  double* const i_1 = &i_1_[ 0 ];
+  double* const i_syn_ex = &i_syn_ex_[ 0 ];
+  double* const i_syn_in = &i_syn_in_[ 0 ];
+  double* const V_m = &V_m_[ 0 ];
+  double* const r_ref = &r_ref_[ 0 ];
+  const double* const weighted_spikes_ex = &weighted_spikes_ex_[ 0 ];
+  const double* const weighted_spikes_in = &weighted_spikes_in_[ 0 ];
+  const double* const current_0 = &current_0_[ 0 ];
+  const double* const current_1 = &current_1_[ 0 ];
+  double* const spiked = &spiked_[ 0 ];
+
+  for ( long lag = from; lag < to; ++lag )
+  {
+    // collect the input of this step from the buffers of the neurons
+    for ( index i = 0; i < size; ++i )
+    {
+      iaf_psc_exp& n = *nodes_[ i ];
+      if ( n.is_frozen() )
+      {
+        weighted_spikes_ex_[ i ] = weighted_spikes_in_[ i ] = current_0_[ i ] = current_1_[ i ] = 0.0;
+        continue;
+      }
+      weighted_spikes_ex_[ i ] = n.B_.spikes_ex_.get_value( lag );
+      weighted_spikes_in_[ i ] = n.B_.spikes_in_.get_value( lag );
+      current_0_[ i ] = n.B_.currents_[ 0 ].get_value( lag );
+      current_1_[ i ] = n.B_.currents_[ 1 ].get_value( lag );
+    }
+
+#pragma omp simd
+    for ( size_t i = 0; i < size; ++i )
+    {
+      // evolve V if the neuron is not refractory
+      const bool not_refractory = r_ref[ i ] == 0;
+      const double V_new = V_m[ i ] * P22[ i ] + i_syn_ex[ i ] * P21ex[ i ] + i_syn_in[ i ] * P21in[ i ]
+        + ( I_e[ i ] + i_0[ i ] ) * P20[ i ];
+      V_m[ i ] = not_refractory ? V_new : V_m[ i ];
+      r_ref[ i ] = not_refractory ? r_ref[ i ] : r_ref[ i ] - 1;
+
+      // exponential decaying PSCs
+      i_syn_ex[ i ] *= P11ex[ i ];
+      i_syn_in[ i ] *= P11in[ i ];
+
+      // add evolution of presynaptic input current
+      i_syn_ex[ i ] += ( 1. - P11ex[ i ] ) * i_1[ i ];
+
+      i_syn_ex[ i ] += weighted_spikes_ex[ i ];
+      i_syn_in[ i ] += weighted_spikes_in[ i ];
+
+      // deterministic threshold crossing
+      const bool spike = V_m[ i ] >= Theta[ i ];
+      r_ref[ i ] = spike ? RefractoryCounts[ i ] : r_ref[ i ];
+      V_m[ i ] = spike ? V_reset[ i ] : V_m[ i ];
+      spiked[ i ] = spike ? 1.0 : 0.0;
+
+      // set new input current
+      i_0[ i ] = current_0[ i ];
+      i_1[ i ] = current_1[ i ];
+    }
+
+    // emit spikes and log state data in the order of the neurons
+    for ( index i = 0; i < size; ++i )
+    {
+      iaf_psc_exp& n = *nodes_[ i ];
+      if ( n.is_frozen() )
+      {
+        continue;
+      }
+      if ( spiked_[ i ] != 0.0 )
+      {
+        n.set_spiketime( Time::step( origin.get_steps() + lag + 1 ) );
+
+        SpikeEvent se;
+        kernel().event_delivery_manager.send( n, se, lag );
+      }
+      if ( n.B_.logger_.is_connected() )
+      {
+        store_( i );
+        n.B_.logger_.record_data( origin.get_steps() + lag );
+      }
+    }
+  }
+
+  for ( std::vector< std::pair< index, State_ > >::const_iterator it = frozen_.begin(); it != frozen_.end(); ++it )
+  {
+    set_state_( it->first, it->second );
+  }
+}
@@ -135,6 +135,7 @@
 #include "rate_connection_delayed.h"
 #include "spike_dilutor.h"
 #include "static_connection.h"
+#include "static_connection_compact.h"
 #include "static_connection_hom_w.h"
 #include "stdp_connection.h"
 #include "stdp_nn_restr_connection.h"
@@ -143,6 +144,7 @@
 #include "stdp_connection_facetshw_hom.h"
 #include "stdp_connection_facetshw_hom_impl.h"
 #include "stdp_connection_hom.h"
+#include "stdp_trace_connection.h"
 #include "stdp_triplet_connection.h"
 #include "stdp_dopa_connection.h"
 #include "stdp_pl_connection_hom.h"
@@ -341,11 +343,9 @@ ModelsModule::init( SLIInterpreter* )
   kernel().model_manager.register_node_model< iaf_chxk_2008 >( "iaf_chxk_2008" );
   kernel().model_manager.register_node_model< iaf_cond_alpha >( "iaf_cond_alpha" );
   kernel().model_manager.register_node_model< iaf_cond_beta >( "iaf_cond_beta" );
-  kernel().model_manager.register_node_model< iaf_cond_exp >( "iaf_cond_exp" );
   kernel().model_manager.register_node_model< iaf_cond_exp_sfa_rr >( "iaf_cond_exp_sfa_rr" );
   kernel().model_manager.register_node_model< iaf_cond_alpha_mc >( "iaf_cond_alpha_mc" );
   kernel().model_manager.register_node_model< hh_cond_beta_gap_traub >( "hh_cond_beta_gap_traub" );
-  kernel().model_manager.register_node_model< hh_psc_alpha >( "hh_psc_alpha" );
   kernel().model_manager.register_node_model< hh_psc_alpha_clopath >( "hh_psc_alpha_clopath" );
   kernel().model_manager.register_node_model< hh_psc_alpha_gap >( "hh_psc_alpha_gap" );
   kernel().model_manager.register_node_model< hh_cond_exp_traub >( "hh_cond_exp_traub" );
@@ -366,6 +366,10 @@ ModelsModule::init( SLIInterpreter* )
   kernel().model_manager.register_node_model< siegert_neuron >( "siegert_neuron" );
 #endif
 
+  // These models use the built-in Dormand-Prince solver.
+  kernel().model_manager.register_node_model< iaf_cond_exp >( "iaf_cond_exp" );
+  kernel().model_manager.register_node_model< hh_psc_alpha >( "hh_psc_alpha" );
+
   // This version of the AdEx model does not depend on GSL.
   kernel().model_manager.register_node_model< aeif_cond_alpha_RK5 >( "aeif_cond_alpha_RK5",
     /*private_model*/ false,
@@ -396,6 +400,7 @@ ModelsModule::init( SLIInterpreter* )
   */
   kernel().model_manager.register_connection_model< StaticConnection< TargetIdentifierPtrRport > >( "static_synapse" );
   kernel().model_manager.register_connection_model< StaticConnection< TargetIdentifierIndex > >( "static_synapse_hpc" );
+  kernel().model_manager.register_connection_model< StaticConnectionCompact >( "static_synapse_compact" );
 
 
   /** @BeginDocumentation
@@ -441,6 +446,9 @@ ModelsModule::init( SLIInterpreter* )
   kernel().model_manager.register_connection_model< STDPConnection< TargetIdentifierPtrRport > >( "stdp_synapse" );
   kernel().model_manager.register_connection_model< STDPConnection< TargetIdentifierIndex > >( "stdp_synapse_hpc" );
 
+  kernel().model_manager.register_connection_model< STDPTraceConnection< TargetIdentifierPtrRport > >(
+    "stdp_trace_synapse" );
+
   kernel().model_manager.register_connection_model< ClopathConnection< TargetIdentifierPtrRport > >( "clopath_synapse",
     /*requires_symmetric=*/false,
     /*requires_clopath_archiving=*/true );
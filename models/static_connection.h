@@ -25,6 +25,7 @@
 
 // Includes from nestkernel:
 #include "connection.h"
+#include "static_connector.h"
 
 namespace nest
 {
@@ -165,6 +166,23 @@ public:
   {
     weight_ = w;
   }
+
+  double
+  get_weight() const
+  {
+    return weight_;
+  }
+};
+
+/**
+ * Static synapses are stored column-wise.
+ */
+template < typename targetidentifierT >
+struct ConnectorTraits< StaticConnection< targetidentifierT > >
+{
+  typedef StaticConnector< StaticConnection< targetidentifierT >,
+    TargetColumns< targetidentifierT >,
+    IndividualWeights< double > > ConnectorType;
 };
 
 template < typename targetidentifierT >
@@ -0,0 +1,106 @@
+/*
+ *  static_connection_compact.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STATICCONNECTION_COMPACT_H
+#define STATICCONNECTION_COMPACT_H
+
+// Includes from nestkernel:
+#include "static_connector.h"
+#include "target_identifier.h"
+
+// Includes from models:
+#include "static_connection.h"
+
+namespace nest
+{
+
+/** @BeginDocumentation
+@ingroup Synapses
+@ingroup static
+
+Name: static_synapse_compact - Variant of static_synapse with 8 Bytes per
+connection.
+
+Description:
+
+static_synapse_compact stores the target neuron as a 2 Byte index, the
+delay and the connection flags in another 2 Bytes and the weight in
+single precision, such that each connection occupies 8 Bytes. This limits
+the number of thread local neurons to 65,535 and the delay to 16383
+simulation steps, and weights are rounded to single precision. No
+support for different receptor types. Otherwise identical to
+static_synapse.
+
+FirstVersion: October 2026
+
+SeeAlso: synapsedict, static_synapse, static_synapse_hpc
+*/
+class StaticConnectionCompact : public StaticConnection< TargetIdentifierIndex >
+{
+public:
+  typedef StaticConnection< TargetIdentifierIndex > StaticConnectionBase;
+
+  StaticConnectionCompact()
+    : StaticConnectionBase()
+  {
+  }
+
+  StaticConnectionCompact( const StaticConnectionCompact& rhs )
+    : StaticConnectionBase( rhs )
+  {
+  }
+
+  void
+  get_status( DictionaryDatum& d ) const
+  {
+    StaticConnectionBase::get_status( d );
+    def< long >( d, names::size_of, sizeof( CompactTargets::EntryType ) + sizeof( float ) );
+  }
+
+  void
+  set_status( const DictionaryDatum& d, ConnectorModel& cm )
+  {
+    // reject delays that do not fit into the compact representation
+    // before they are registered with the delay checker
+    double delay;
+    if ( updateValue< double >( d, names::delay, delay )
+      and Time::delay_ms_to_steps( delay ) > CompactTargets::MAX_DELAY )
+    {
+      throw BadDelay( delay, "Delay must be smaller than or equal to the maximal delay of compact synapses" );
+    }
+    StaticConnectionBase::set_status( d, cm );
+  }
+};
+
+/**
+ * Compact static synapses are stored in a packed target column and a
+ * single-precision weight column.
+ */
+template <>
+struct ConnectorTraits< StaticConnectionCompact >
+{
+  typedef StaticConnector< StaticConnectionCompact, CompactTargets, IndividualWeights< float > > ConnectorType;
+};
+
+} // namespace
+
+#endif /* #ifndef STATICCONNECTION_COMPACT_H */
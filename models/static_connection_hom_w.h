@@ -26,6 +26,7 @@
 // Includes from nestkernel:
 #include "common_properties_hom_w.h"
 #include "connection.h"
+#include "static_connector.h"
 
 namespace nest
 {
@@ -174,6 +175,17 @@ public:
   }
 };
 
+/**
+ * Static synapses with homogeneous weight are stored column-wise.
+ */
+template < typename targetidentifierT >
+struct ConnectorTraits< StaticConnectionHomW< targetidentifierT > >
+{
+  typedef StaticConnector< StaticConnectionHomW< targetidentifierT >,
+    TargetColumns< targetidentifierT >,
+    HomogeneousWeight > ConnectorType;
+};
+
 
 template < typename targetidentifierT >
 void
@@ -0,0 +1,338 @@
+/*
+ *  stdp_trace_connection.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STDP_TRACE_CONNECTION_H
+#define STDP_TRACE_CONNECTION_H
+
+// C++ includes:
+#include <cmath>
+
+// Includes from nestkernel:
+#include "common_synapse_properties.h"
+#include "connection.h"
+#include "connector_model.h"
+#include "event.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+#include "dictutils.h"
+
+namespace nest
+{
+
+/** @BeginDocumentation
+@ingroup Synapses
+@ingroup stdp
+
+Name: stdp_trace_synapse - Synapse type for spike-timing dependent
+plasticity that reads the postsynaptic trace buffer.
+
+Description:
+
+stdp_trace_synapse implements the same plasticity rule as stdp_synapse,
+but does not read the spike history of the postsynaptic neuron. Instead,
+the postsynaptic neuron keeps the times of its most recent spikes and the
+values of its trace in a ring buffer of fixed length trace_buffer_size,
+which the synapse searches by bisection. The memory per neuron is thus
+bounded and independent of the number of incoming synapses and of the
+firing rate, and the synapse does not need to walk the history.
+
+The results are identical to those of stdp_synapse as long as no
+postsynaptic spike is dropped from the buffer before all synapses have
+read it, i.e., as long as the neuron emits at most trace_buffer_size
+spikes between two consecutive presynaptic spikes of any incoming
+stdp_trace_synapse, shifted by the dendritic delay. Spikes dropped too
+early do not facilitate the synapse; depression is not affected. The status of the
+postsynaptic neuron reports the memory used by the buffer
+(trace_buffer_memory) and the number of dropped spikes
+(trace_buffer_dropped).
+
+Examples:
+
+    multiplicative STDP [2]  mu_plus = mu_minus = 1.0
+    additive STDP       [3]  mu_plus = mu_minus = 0.0
+    Guetig STDP         [1]  mu_plus = mu_minus = [0.0,1.0]
+    van Rossum STDP     [4]  mu_plus = 0.0 mu_minus = 1.0
+
+Parameters:
+\verbatim embed:rst
+========= =======  ======================================================
+ tau_plus  ms      Time constant of STDP window, potentiation
+                   (tau_minus defined in post-synaptic neuron)
+ lambda    real    Step size
+ alpha     real    Asymmetry parameter (scales depressing increments as
+                   alpha*lambda)
+ mu_plus   real    Weight dependence exponent, potentiation
+ mu_minus  real    Weight dependence exponent, depression
+ Wmax      real    Maximum allowed weight
+========= =======  ======================================================
+\endverbatim
+
+Transmits: SpikeEvent
+
+References:
+
+\verbatim embed:rst
+.. [1] Guetig et al. (2003). Learning input correlations through nonlinear
+       temporally asymmetric hebbian plasticity. Journal of Neuroscience,
+       23:3697-3714 DOI: https://doi.org/10.1523/JNEUROSCI.23-09-03697.2003
+.. [2] Rubin J, Lee D, Sompolinsky H (2001). Equilibrium
+       properties of temporally asymmetric Hebbian plasticity. Physical Review
+       Letters, 86:364-367. DOI: https://doi.org/10.1103/PhysRevLett.86.364
+.. [3] Song S, Miller KD, Abbott LF (2000). Competitive Hebbian learning
+       through spike-timing-dependent synaptic plasticity. Nature Neuroscience
+       3(9):919-926.
+       DOI: https://doi.org/10.1038/78829
+.. [4] van Rossum MCW, Bi G-Q, Turrigiano GG (2000). Stable Hebbian learning
+       from spike timing-dependent plasticity. Journal of Neuroscience,
+       20(23):8812-8821.
+       DOI: https://doi.org/10.1523/JNEUROSCI.20-23-08812.2000
+\endverbatim
+
+FirstVersion: October 2026
+
+SeeAlso: synapsedict, stdp_synapse, static_synapse
+*/
+// connections are templates of target identifier type (used for pointer /
+// target index addressing) derived from generic connection template
+template < typename targetidentifierT >
+class STDPTraceConnection : public Connection< targetidentifierT >
+{
+
+public:
+  typedef CommonSynapseProperties CommonPropertiesType;
+  typedef Connection< targetidentifierT > ConnectionBase;
+
+  /**
+   * Default Constructor.
+   * Sets default values for all parameters. Needed by GenericConnectorModel.
+   */
+  STDPTraceConnection();
+
+
+  /**
+   * Copy constructor.
+   * Needs to be defined properly in order for GenericConnector to work.
+   */
+  STDPTraceConnection( const STDPTraceConnection& );
+
+  // Explicitly declare all methods inherited from the dependent base
+  // ConnectionBase. This avoids explicit name prefixes in all places these
+  // functions are used. Since ConnectionBase depends on the template parameter,
+  // they are not automatically found in the base class.
+  using ConnectionBase::get_delay_steps;
+  using ConnectionBase::get_delay;
+  using ConnectionBase::get_rport;
+  using ConnectionBase::get_target;
+
+  /**
+   * Get all properties of this connection and put them into a dictionary.
+   */
+  void get_status( DictionaryDatum& d ) const;
+
+  /**
+   * Set properties of this connection from the values given in dictionary.
+   */
+  void set_status( const DictionaryDatum& d, ConnectorModel& cm );
+
+  /**
+   * Send an event to the receiver of this connection.
+   * \param e The event to send
+   * \param cp common properties of all synapses (empty).
+   */
+  void send( Event& e, thread t, const CommonSynapseProperties& cp );
+
+
+  class ConnTestDummyNode : public ConnTestDummyNodeBase
+  {
+  public:
+    // Ensure proper overriding of overloaded virtual functions.
+    // Return values from functions are ignored.
+    using ConnTestDummyNodeBase::handles_test_event;
+    port
+    handles_test_event( SpikeEvent&, rport )
+    {
+      return invalid_port_;
+    }
+  };
+
+  void
+  check_connection( Node& s, Node& t, rport receptor_type, const CommonPropertiesType& )
+  {
+    ConnTestDummyNode dummy_target;
+
+    ConnectionBase::check_connection_( dummy_target, s, t, receptor_type );
+
+    t.register_trace_connection();
+  }
+
+  void
+  set_weight( double w )
+  {
+    weight_ = w;
+  }
+
+private:
+  double
+  facilitate_( double w, double kplus )
+  {
+    double norm_w = ( w / Wmax_ ) + ( lambda_ * std::pow( 1.0 - ( w / Wmax_ ), mu_plus_ ) * kplus );
+    return norm_w < 1.0 ? norm_w * Wmax_ : Wmax_;
+  }
+
+  double
+  depress_( double w, double kminus )
+  {
+    double norm_w = ( w / Wmax_ ) - ( alpha_ * lambda_ * std::pow( w / Wmax_, mu_minus_ ) * kminus );
+    return norm_w > 0.0 ? norm_w * Wmax_ : 0.0;
+  }
+
+  // data members of each connection
+  double weight_;
+  double tau_plus_;
+  double lambda_;
+  double alpha_;
+  double mu_plus_;
+  double mu_minus_;
+  double Wmax_;
+  double Kplus_;
+
+  double t_lastspike_;
+};
+
+
+/**
+ * Send an event to the receiver of this connection.
+ * \param e The event to send
+ * \param t The thread on which this connection is stored.
+ * \param cp Common properties object, containing the stdp parameters.
+ */
+template < typename targetidentifierT >
+inline void
+STDPTraceConnection< targetidentifierT >::send( Event& e, thread t, const CommonSynapseProperties& )
+{
+  // synapse STDP depressing/facilitation dynamics
+  const double t_spike = e.get_stamp().get_ms();
+
+  // use accessor functions (inherited from Connection< >) to obtain delay and
+  // target
+  Node* target = get_target( t );
+  double dendritic_delay = get_delay();
+
+  // facilitation due to post-synaptic spikes since last pre-synaptic spike,
+  // i.e., in the range (t_lastspike_ - dendritic_delay, t_spike -
+  // dendritic_delay], using the same tolerance as Archiving_Node::get_history()
+  const TraceBuffer& traces = target->get_trace_buffer();
+  const double eps = kernel().connection_manager.get_stdp_eps();
+  const size_t finish = traces.find( t_spike - dendritic_delay + eps );
+  for ( size_t i = traces.find( t_lastspike_ - dendritic_delay + eps ); i < finish; ++i )
+  {
+    const double minus_dt = t_lastspike_ - ( traces[ i ].t_ + dendritic_delay );
+    assert( minus_dt < -1.0 * eps );
+    weight_ = facilitate_( weight_, Kplus_ * std::exp( minus_dt / tau_plus_ ) );
+  }
+
+  const double _K_value = target->get_trace_K_value( t_spike - dendritic_delay );
+  weight_ = depress_( weight_, _K_value );
+
+  e.set_receiver( *target );
+  e.set_weight( weight_ );
+  // use accessor functions (inherited from Connection< >) to obtain delay in
+  // steps and rport
+  e.set_delay_steps( get_delay_steps() );
+  e.set_rport( get_rport() );
+  e();
+
+  Kplus_ = Kplus_ * std::exp( ( t_lastspike_ - t_spike ) / tau_plus_ ) + 1.0;
+
+  t_lastspike_ = t_spike;
+}
+
+
+template < typename targetidentifierT >
+STDPTraceConnection< targetidentifierT >::STDPTraceConnection()
+  : ConnectionBase()
+  , weight_( 1.0 )
+  , tau_plus_( 20.0 )
+  , lambda_( 0.01 )
+  , alpha_( 1.0 )
+  , mu_plus_( 1.0 )
+  , mu_minus_( 1.0 )
+  , Wmax_( 100.0 )
+  , Kplus_( 0.0 )
+  , t_lastspike_( 0.0 )
+{
+}
+
+template < typename targetidentifierT >
+STDPTraceConnection< targetidentifierT >::STDPTraceConnection( const STDPTraceConnection< targetidentifierT >& rhs )
+  : ConnectionBase( rhs )
+  , weight_( rhs.weight_ )
+  , tau_plus_( rhs.tau_plus_ )
+  , lambda_( rhs.lambda_ )
+  , alpha_( rhs.alpha_ )
+  , mu_plus_( rhs.mu_plus_ )
+  , mu_minus_( rhs.mu_minus_ )
+  , Wmax_( rhs.Wmax_ )
+  , Kplus_( rhs.Kplus_ )
+  , t_lastspike_( rhs.t_lastspike_ )
+{
+}
+
+template < typename targetidentifierT >
+void
+STDPTraceConnection< targetidentifierT >::get_status( DictionaryDatum& d ) const
+{
+  ConnectionBase::get_status( d );
+  def< double >( d, names::weight, weight_ );
+  def< double >( d, names::tau_plus, tau_plus_ );
+  def< double >( d, names::lambda, lambda_ );
+  def< double >( d, names::alpha, alpha_ );
+  def< double >( d, names::mu_plus, mu_plus_ );
+  def< double >( d, names::mu_minus, mu_minus_ );
+  def< double >( d, names::Wmax, Wmax_ );
+  def< long >( d, names::size_of, sizeof( *this ) );
+}
+
+template < typename targetidentifierT >
+void
+STDPTraceConnection< targetidentifierT >::set_status( const DictionaryDatum& d, ConnectorModel& cm )
+{
+  ConnectionBase::set_status( d, cm );
+  updateValue< double >( d, names::weight, weight_ );
+  updateValue< double >( d, names::tau_plus, tau_plus_ );
+  updateValue< double >( d, names::lambda, lambda_ );
+  updateValue< double >( d, names::alpha, alpha_ );
+  updateValue< double >( d, names::mu_plus, mu_plus_ );
+  updateValue< double >( d, names::mu_minus, mu_minus_ );
+  updateValue< double >( d, names::Wmax, Wmax_ );
+
+  // check if weight_ and Wmax_ has the same sign
+  if ( not( ( ( weight_ >= 0 ) - ( weight_ < 0 ) ) == ( ( Wmax_ >= 0 ) - ( Wmax_ < 0 ) ) ) )
+  {
+    throw BadProperty( "Weight and Wmax must have same sign." );
+  }
+}
+
+} // of namespace nest
+
+#endif // of #ifndef STDP_TRACE_CONNECTION_H
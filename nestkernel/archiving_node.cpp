@@ -42,6 +42,7 @@ namespace nest
 
 nest::Archiving_Node::Archiving_Node()
   : n_incoming_( 0 )
+  , n_trace_incoming_( 0 )
   , Kminus_( 0.0 )
   , triplet_Kminus_( 0.0 )
   , tau_minus_( 20.0 )
@@ -49,6 +50,8 @@ nest::Archiving_Node::Archiving_Node()
   , tau_minus_triplet_( 110.0 )
   , tau_minus_triplet_inv_( 1. / tau_minus_triplet_ )
   , last_spike_( -1.0 )
+  , trace_buffer_size_( 64 )
+  , trace_buffer_()
   , Ca_t_( 0.0 )
   , Ca_minus_( 0.0 )
   , tau_Ca_( 10000.0 )
@@ -60,6 +63,7 @@ nest::Archiving_Node::Archiving_Node()
 nest::Archiving_Node::Archiving_Node( const Archiving_Node& n )
   : Node( n )
   , n_incoming_( n.n_incoming_ )
+  , n_trace_incoming_( n.n_trace_incoming_ )
   , Kminus_( n.Kminus_ )
   , triplet_Kminus_( n.triplet_Kminus_ )
   , tau_minus_( n.tau_minus_ )
@@ -69,6 +73,8 @@ nest::Archiving_Node::Archiving_Node( const Archiving_Node& n )
   , max_delay_( n.max_delay_ )
   , trace_( n.trace_ )
   , last_spike_( n.last_spike_ )
+  , trace_buffer_size_( n.trace_buffer_size_ )
+  , trace_buffer_( n.trace_buffer_ )
   , Ca_t_( n.Ca_t_ )
   , Ca_minus_( n.Ca_minus_ )
   , tau_Ca_( n.tau_Ca_ )
@@ -97,6 +103,26 @@ Archiving_Node::register_stdp_connection( double t_first_read, double delay )
   max_delay_ = std::max( delay, max_delay_ );
 }
 
+void
+Archiving_Node::register_trace_connection()
+{
+  if ( trace_buffer_.capacity() != trace_buffer_size_ )
+  {
+    trace_buffer_.resize( trace_buffer_size_ );
+  }
+
+  n_trace_incoming_++;
+}
+
+double
+nest::Archiving_Node::get_trace_K_value( double t )
+{
+  // latest post spike that came strictly before `t`, see get_K_value()
+  const TraceBuffer::Entry* const entry = trace_buffer_.find_before( t - kernel().connection_manager.get_stdp_eps() );
+  trace_ = entry != 0 ? entry->Kminus_ * std::exp( ( entry->t_ - t ) * tau_minus_inv_ ) : 0.;
+  return trace_;
+}
+
 double
 nest::Archiving_Node::get_K_value( double t )
 {
@@ -226,10 +252,21 @@ nest::Archiving_Node::set_spiketime( Time const& t_sp, double offset )
     last_spike_ = t_sp_ms;
     history_.push_back( histentry( last_spike_, Kminus_, triplet_Kminus_, 0 ) );
   }
+  else if ( n_trace_incoming_ )
+  {
+    Kminus_ = Kminus_ * std::exp( ( last_spike_ - t_sp_ms ) * tau_minus_inv_ ) + 1.0;
+    triplet_Kminus_ = triplet_Kminus_ * std::exp( ( last_spike_ - t_sp_ms ) * tau_minus_triplet_inv_ ) + 1.0;
+    last_spike_ = t_sp_ms;
+  }
   else
   {
     last_spike_ = t_sp_ms;
   }
+
+  if ( n_trace_incoming_ )
+  {
+    trace_buffer_.push_back( last_spike_, Kminus_ );
+  }
 }
 
 void
@@ -248,6 +285,9 @@ nest::Archiving_Node::get_status( DictionaryDatum& d ) const
 #ifdef DEBUG_ARCHIVER
   def< int >( d, names::archiver_length, history_.size() );
 #endif
+  def< long >( d, names::trace_buffer_size, trace_buffer_size_ );
+  def< long >( d, names::trace_buffer_memory, trace_buffer_.get_memory() );
+  def< long >( d, names::trace_buffer_dropped, trace_buffer_.get_num_dropped() );
 
   synaptic_elements_d = DictionaryDatum( new Dictionary );
   def< DictionaryDatum >( d, names::synaptic_elements, synaptic_elements_d );
@@ -298,6 +338,19 @@ nest::Archiving_Node::set_status( const DictionaryDatum& d )
   }
   beta_Ca_ = new_beta_Ca;
 
+  // changing the size of an allocated trace buffer discards its entries
+  long new_trace_buffer_size = trace_buffer_size_;
+  updateValue< long >( d, names::trace_buffer_size, new_trace_buffer_size );
+  if ( new_trace_buffer_size < 1 )
+  {
+    throw BadProperty( "trace_buffer_size must be positive." );
+  }
+  trace_buffer_size_ = new_trace_buffer_size;
+  if ( n_trace_incoming_ and trace_buffer_.capacity() != trace_buffer_size_ )
+  {
+    trace_buffer_.resize( trace_buffer_size_ );
+  }
+
   // check, if to clear spike history and K_minus
   bool clear = false;
   updateValue< bool >( d, names::clear, clear );
@@ -346,6 +399,7 @@ nest::Archiving_Node::clear_history()
   Kminus_ = 0.0;
   triplet_Kminus_ = 0.0;
   history_.clear();
+  trace_buffer_.clear();
   Ca_minus_ = 0.0;
   Ca_t_ = 0.0;
 }
@@ -191,6 +191,27 @@ public:
    */
   void register_stdp_connection( double t_first_read, double delay );
 
+  /**
+   * Register a new incoming STDP connection that reads the trace buffer
+   * instead of the spike history. Allocates the buffer for the first
+   * connection.
+   */
+  void register_trace_connection();
+
+  /**
+   * \fn const TraceBuffer& get_trace_buffer()
+   * return the ring buffer of the trace_buffer_size most recent spikes
+   * and the Kminus values at these spikes.
+   */
+  const TraceBuffer& get_trace_buffer() const;
+
+  /**
+   * \fn double get_trace_K_value(double t)
+   * return the Kminus value at t (in ms) like get_K_value(), but find the
+   * latest spike before t by bisection in the trace buffer.
+   */
+  double get_trace_K_value( double t );
+
   void get_status( DictionaryDatum& d ) const;
   void set_status( const DictionaryDatum& d );
 
@@ -224,6 +245,9 @@ protected:
   // read the spikehistory for a given point in time
   size_t n_incoming_;
 
+  // number of incoming connections that read the trace buffer
+  size_t n_trace_incoming_;
+
 private:
   // sum exp(-(t-ti)/tau_minus)
   double Kminus_;
@@ -246,6 +270,13 @@ private:
   // spiking history needed by stdp synapses
   std::deque< histentry > history_;
 
+  // number of entries of the trace buffer
+  size_t trace_buffer_size_;
+
+  // most recent spikes and Kminus values, needed by stdp synapses that
+  // read the trace buffer
+  TraceBuffer trace_buffer_;
+
   /*
    * Structural plasticity
    */
@@ -276,6 +307,12 @@ Archiving_Node::get_spiketime_ms() const
   return last_spike_;
 }
 
+inline const TraceBuffer&
+Archiving_Node::get_trace_buffer() const
+{
+  return trace_buffer_;
+}
+
 inline double
 Archiving_Node::get_tau_Ca() const
 {
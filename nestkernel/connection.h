@@ -124,6 +124,8 @@ public:
   // connections not used in primary connectors
   typedef SecondaryEvent EventType;
 
+  typedef targetidentifierT TargetIdentifierType;
+
   Connection()
     : target_()
     , syn_id_delay_( 1.0 )
@@ -247,6 +249,38 @@ public:
     return target_.get_rport();
   }
 
+  /**
+   * Return the target identifier, used by connectors that store
+   * targets separately from the other connection properties.
+   */
+  const targetidentifierT&
+  get_target_identifier() const
+  {
+    return target_;
+  }
+
+  void
+  set_target_identifier( const targetidentifierT& target )
+  {
+    target_ = target;
+  }
+
+  /**
+   * Return synapse type, delay and flags, used by connectors that store
+   * them separately from the other connection properties.
+   */
+  const SynIdDelay&
+  get_syn_id_delay() const
+  {
+    return syn_id_delay_;
+  }
+
+  void
+  set_syn_id_delay( const SynIdDelay& syn_id_delay )
+  {
+    syn_id_delay_ = syn_id_delay;
+  }
+
   /**
    * Sets a flag in the connection to signal that the following connection has
    * the same source.
@@ -70,6 +70,7 @@ nest::ConnectionManager::ConnectionManager()
   , keep_source_table_( true )
   , have_connections_changed_( true )
   , sort_connections_by_source_( true )
+  , use_compressed_spikes_( false )
   , has_primary_connections_( false )
   , check_primary_connections_()
   , secondary_connections_exist_( false )
@@ -95,6 +96,7 @@ nest::ConnectionManager::initialize()
   connections_.resize( num_threads );
   secondary_recv_buffer_pos_.resize( num_threads );
   sort_connections_by_source_ = true;
+  use_compressed_spikes_ = false;
 
   check_primary_connections_.resize( num_threads, false );
   check_secondary_connections_.resize( num_threads, false );
@@ -130,6 +132,7 @@ nest::ConnectionManager::finalize()
   delete_connections_();
   std::vector< std::vector< ConnectorBase* > >().swap( connections_ );
   std::vector< std::vector< std::vector< size_t > > >().swap( secondary_recv_buffer_pos_ );
+  std::vector< std::vector< std::vector< index > > >().swap( compressed_spike_data_ );
 }
 
 void
@@ -155,6 +158,27 @@ nest::ConnectionManager::set_status( const DictionaryDatum& d )
       "If structural plasticity is enabled, sort_connections_by_source can not "
       "be set to false." );
   }
+
+  bool use_compressed_spikes = use_compressed_spikes_;
+  updateValue< bool >( d, names::use_compressed_spikes, use_compressed_spikes );
+  if ( use_compressed_spikes != use_compressed_spikes_ )
+  {
+    if ( get_num_connections() > 0 )
+    {
+      throw KernelException( "use_compressed_spikes can only be changed before connections are created." );
+    }
+    use_compressed_spikes_ = use_compressed_spikes;
+  }
+  if ( use_compressed_spikes_ and not sort_connections_by_source_ )
+  {
+    throw KernelException(
+      "If use_compressed_spikes is set to true, sort_connections_by_source "
+      "can not be set to false." );
+  }
+  if ( use_compressed_spikes_ and kernel().sp_manager.is_structural_plasticity_enabled() )
+  {
+    throw KernelException( "Compressed spikes can not be used if structural plasticity is enabled." );
+  }
   //  Need to update the saved values if we have changed the delay bounds.
   if ( d->known( names::min_delay ) or d->known( names::max_delay ) )
   {
@@ -179,6 +203,7 @@ nest::ConnectionManager::get_status( DictionaryDatum& dict )
   def< long >( dict, names::num_connections, n );
   def< bool >( dict, names::keep_source_table, keep_source_table_ );
   def< bool >( dict, names::sort_connections_by_source, sort_connections_by_source_ );
+  def< bool >( dict, names::use_compressed_spikes, use_compressed_spikes_ );
 }
 
 DictionaryDatum
@@ -1442,6 +1467,14 @@ nest::ConnectionManager::compute_compressed_secondary_recv_buffer_positions( con
   }
 }
 
+void
+nest::ConnectionManager::compute_compressed_spike_data()
+{
+  assert( use_compressed_spikes_ );
+  assert( sort_connections_by_source_ );
+  source_table_.fill_compressed_spike_data( compressed_spike_data_ );
+}
+
 void
 nest::ConnectionManager::set_stdp_eps( const double stdp_eps )
 {
@@ -78,6 +78,13 @@ public:
   void compute_target_data_buffer_size();
   void compute_compressed_secondary_recv_buffer_positions( const thread tid );
 
+  /**
+   * Builds the lookup table from which received compressed spikes are
+   * expanded to the local connections on all threads. Must be called
+   * by a single thread after connections have been sorted.
+   */
+  void compute_compressed_spike_data();
+
   /**
    * Add a connectivity rule, i.e. the respective ConnBuilderFactory.
    */
@@ -248,6 +255,17 @@ public:
   void
   send( const thread tid, const synindex syn_id, const index lcid, const std::vector< ConnectorModel* >& cm, Event& e );
 
+  /**
+   * Send the spikes in [first, last), sorted by lcid and time stamp,
+   * through the connections of type syn_id.
+   */
+  void send_batch( const thread tid,
+    const synindex syn_id,
+    const PendingSpike* first,
+    const PendingSpike* last,
+    const std::vector< ConnectorModel* >& cm,
+    Event& e );
+
   /**
    * Send event e to all device targets of source source_gid
    */
@@ -319,6 +337,32 @@ public:
    */
   bool get_sort_connections_by_source() const;
 
+  /**
+   * Returns use_compressed_spikes_, which indicates whether spikes are
+   * communicated once per source, synapse type and target rank instead
+   * of once per target thread.
+   */
+  bool use_compressed_spikes() const;
+
+  /**
+   * Returns the local connection ids on all threads of the first
+   * connection of the compressed source idx; invalid_index marks
+   * threads without targets of this source.
+   */
+  const std::vector< index >& get_compressed_spike_data( const synindex syn_id, const index idx ) const;
+
+  /**
+   * Returns whether idx is a valid index into the compressed spike
+   * data of the given synapse type.
+   */
+  bool is_valid_compressed_spike_data( const synindex syn_id, const index idx ) const;
+
+  /**
+   * Returns the compressed spike data of all synapse types.
+   * structure: synapses|sources|threads
+   */
+  const std::vector< std::vector< std::vector< index > > >& get_compressed_spike_data() const;
+
   /**
    * Sorts connections in the presynaptic infrastructure by increasing
    * source gid.
@@ -538,6 +582,14 @@ private:
 
   std::map< index, size_t > buffer_pos_of_source_gid_syn_id_;
 
+  /**
+   * Stores, for each synapse type and unique source with primary
+   * connections on this rank, the local connection id of the first
+   * connection of this source on each thread.
+   * structure: synapses|sources|threads
+   */
+  std::vector< std::vector< std::vector< index > > > compressed_spike_data_;
+
   /**
    * A structure to hold the information about targets for each
    * neuron on the presynaptic side. Internally arranged in a 3d
@@ -585,6 +637,9 @@ private:
   //! Whether to sort connections by source gid.
   bool sort_connections_by_source_;
 
+  //! Whether to communicate spikes once per source and target rank.
+  bool use_compressed_spikes_;
+
   //! Whether primary connections (spikes) exist.
   bool has_primary_connections_;
 
@@ -774,6 +829,30 @@ ConnectionManager::get_sort_connections_by_source() const
   return sort_connections_by_source_;
 }
 
+inline bool
+ConnectionManager::use_compressed_spikes() const
+{
+  return use_compressed_spikes_;
+}
+
+inline const std::vector< index >&
+ConnectionManager::get_compressed_spike_data( const synindex syn_id, const index idx ) const
+{
+  return compressed_spike_data_[ syn_id ][ idx ];
+}
+
+inline bool
+ConnectionManager::is_valid_compressed_spike_data( const synindex syn_id, const index idx ) const
+{
+  return syn_id < compressed_spike_data_.size() and idx < compressed_spike_data_[ syn_id ].size();
+}
+
+inline const std::vector< std::vector< std::vector< index > > >&
+ConnectionManager::get_compressed_spike_data() const
+{
+  return compressed_spike_data_;
+}
+
 inline double
 ConnectionManager::get_stdp_eps() const
 {
@@ -796,6 +875,17 @@ ConnectionManager::send( const thread tid,
   connections_[ tid ][ syn_id ]->send( tid, lcid, cm, e );
 }
 
+inline void
+ConnectionManager::send_batch( const thread tid,
+  const synindex syn_id,
+  const PendingSpike* first,
+  const PendingSpike* last,
+  const std::vector< ConnectorModel* >& cm,
+  Event& e )
+{
+  connections_[ tid ][ syn_id ]->send_batch( tid, first, last, cm, e );
+}
+
 inline void
 ConnectionManager::restructure_connection_tables( const thread tid )
 {
@@ -44,6 +44,7 @@
 #include "nest_names.h"
 #include "node.h"
 #include "source.h"
+#include "spike_data.h"
 #include "spikecounter.h"
 
 // Includes from sli:
@@ -157,6 +158,18 @@ public:
    */
   virtual index send( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, Event& e ) = 0;
 
+  /**
+   * Send each of the spikes in [first, last), which are sorted by lcid and
+   * time stamp, to the connection at its lcid and the subsequent
+   * connections with the same source. Stamp, offset and sender of e are
+   * set from the spikes.
+   */
+  virtual void send_batch( const thread tid,
+    const PendingSpike* first,
+    const PendingSpike* const last,
+    const std::vector< ConnectorModel* >& cm,
+    Event& e ) = 0;
+
   virtual void
   send_weight_event( const thread tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp ) = 0;
 
@@ -170,7 +183,9 @@ public:
     const std::vector< ConnectorModel* >& cm ) = 0;
 
   /**
-   * Sort connections according to source gids.
+   * Sort connections according to source gids. Only connections added
+   * since the last call are sorted and then merged with the already
+   * sorted ones.
    */
   virtual void sort_connections( BlockVector< Source >& ) = 0;
 
@@ -207,6 +222,18 @@ public:
    * Remove disabled connections from the connector.
    */
   virtual void remove_disabled_connections( const index first_disabled_index ) = 0;
+
+protected:
+  /**
+   * Send a WeightRecorderEvent for the event e delivered through the
+   * connection at position lcid, if a weight recorder is set in cp.
+   * Implemented in connector_base_impl.h
+   */
+  void send_weight_event_( const thread tid,
+    const synindex syn_id,
+    const unsigned int lcid,
+    Event& e,
+    const CommonSynapseProperties& cp );
 };
 
 /**
@@ -219,9 +246,13 @@ private:
   BlockVector< ConnectionT > C_;
   const synindex syn_id_;
 
+  //! number of connections at the front of C_ that are sorted by source
+  index num_sorted_;
+
 public:
   explicit Connector( const synindex syn_id )
     : syn_id_( syn_id )
+    , num_sorted_( 0 )
   {
   }
 
@@ -410,6 +441,22 @@ public:
     return 1 + lcid_offset; // event was delivered to at least one target
   }
 
+  void
+  send_batch( const thread tid,
+    const PendingSpike* first,
+    const PendingSpike* const last,
+    const std::vector< ConnectorModel* >& cm,
+    Event& e )
+  {
+    for ( ; first != last; ++first )
+    {
+      e.set_stamp( first->stamp_ );
+      e.set_offset( first->offset_ );
+      e.set_sender_gid( first->sender_gid_ );
+      Connector< ConnectionT >::send( tid, first->lcid_, cm, e );
+    }
+  }
+
   // Implemented in connector_base_impl.h
   void send_weight_event( const thread tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp );
 
@@ -436,7 +483,8 @@ public:
   void
   sort_connections( BlockVector< Source >& sources )
   {
-    nest::sort( sources, C_ );
+    nest::sort_incrementally( sources, C_, num_sorted_ );
+    num_sorted_ = C_.size();
   }
 
   void
@@ -484,6 +532,8 @@ public:
   {
     assert( not C_[ lcid ].is_disabled() );
     C_[ lcid ].disable();
+    // disabled connections are sorted to the end
+    num_sorted_ = std::min( num_sorted_, lcid );
   }
 
   void
@@ -491,9 +541,21 @@ public:
   {
     assert( C_[ first_disabled_index ].is_disabled() );
     C_.erase( C_.begin() + first_disabled_index, C_.end() );
+    num_sorted_ = std::min( num_sorted_, first_disabled_index );
   }
 };
 
+/**
+ * Selects the Connector that stores connections of type ConnectionT.
+ * Synapse models with a specialized storage layout specialize this
+ * template in their header.
+ */
+template < typename ConnectionT >
+struct ConnectorTraits
+{
+  typedef Connector< ConnectionT > ConnectorType;
+};
+
 } // of namespace nest
 
 #endif
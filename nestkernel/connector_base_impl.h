@@ -21,6 +21,7 @@
  */
 
 #include "connector_base.h"
+#include "static_connector.h"
 
 // Includes from nestkernel:
 #include "kernel_manager.h"
@@ -31,9 +32,9 @@
 namespace nest
 {
 
-template < typename ConnectionT >
-void
-Connector< ConnectionT >::send_weight_event( const thread tid,
+inline void
+ConnectorBase::send_weight_event_( const thread tid,
+  const synindex syn_id,
   const unsigned int lcid,
   Event& e,
   const CommonSynapseProperties& cp )
@@ -46,7 +47,7 @@ Connector< ConnectionT >::send_weight_event( const thread tid,
     wr_e.set_rport( e.get_rport() );
     wr_e.set_stamp( e.get_stamp() );
     wr_e.set_sender( e.get_sender() );
-    wr_e.set_sender_gid( kernel().connection_manager.get_source_gid( tid, syn_id_, lcid ) );
+    wr_e.set_sender_gid( kernel().connection_manager.get_source_gid( tid, syn_id, lcid ) );
     wr_e.set_weight( e.get_weight() );
     wr_e.set_delay_steps( e.get_delay_steps() );
     // Set weight_recorder as receiver
@@ -57,6 +58,26 @@ Connector< ConnectionT >::send_weight_event( const thread tid,
   }
 }
 
+template < typename ConnectionT >
+void
+Connector< ConnectionT >::send_weight_event( const thread tid,
+  const unsigned int lcid,
+  Event& e,
+  const CommonSynapseProperties& cp )
+{
+  send_weight_event_( tid, syn_id_, lcid, e, cp );
+}
+
+template < typename ConnectionT, typename TargetsT, typename WeightsT >
+void
+StaticConnector< ConnectionT, TargetsT, WeightsT >::send_weight_event( const thread tid,
+  const unsigned int lcid,
+  Event& e,
+  const CommonSynapseProperties& cp )
+{
+  send_weight_event_( tid, syn_id_, lcid, e, cp );
+}
+
 } // of namespace nest
 
 #endif
@@ -267,7 +267,7 @@ GenericConnectorModel< ConnectionT >::add_connection_( Node& src,
   {
     // No homogeneous Connector with this syn_id exists, we need to create a new
     // homogeneous Connector.
-    thread_local_connectors[ syn_id ] = new Connector< ConnectionT >( syn_id );
+    thread_local_connectors[ syn_id ] = new typename ConnectorTraits< ConnectionT >::ConnectorType( syn_id );
   }
 
   ConnectorBase* connector = thread_local_connectors[ syn_id ];
@@ -277,7 +277,8 @@ GenericConnectorModel< ConnectionT >::add_connection_( Node& src,
   assert( connector != 0 );
 
   // TODO: simplify: push_back should not return anything
-  Connector< ConnectionT >* vc = static_cast< Connector< ConnectionT >* >( connector );
+  typename ConnectorTraits< ConnectionT >::ConnectorType* vc =
+    static_cast< typename ConnectorTraits< ConnectionT >::ConnectorType* >( connector );
   connector = &vc->push_back( connection );
 
   thread_local_connectors[ syn_id ] = connector;
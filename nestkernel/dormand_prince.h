@@ -0,0 +1,453 @@
+/*
+ *  dormand_prince.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef DORMAND_PRINCE_H
+#define DORMAND_PRINCE_H
+
+// C++ includes:
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace nest
+{
+
+/**
+ * Coefficients of the embedded Runge-Kutta method of order 5(4) by
+ * Dormand and Prince and of the step size control shared by
+ * DormandPrince and BatchDormandPrince.
+ *
+ * The step size control follows the standard control of the GSL with
+ * a_y = 1 and a_dydt = 0: a step is rejected and the step size reduced
+ * if the error of any component exceeds eps_abs + eps_rel |y_i| by more
+ * than 10%, and the step size is increased if all errors are below half
+ * of that bound.
+ */
+namespace dormand_prince
+{
+const double a21 = 1.0 / 5.0;
+const double a31 = 3.0 / 40.0;
+const double a32 = 9.0 / 40.0;
+const double a41 = 44.0 / 45.0;
+const double a42 = -56.0 / 15.0;
+const double a43 = 32.0 / 9.0;
+const double a51 = 19372.0 / 6561.0;
+const double a52 = -25360.0 / 2187.0;
+const double a53 = 64448.0 / 6561.0;
+const double a54 = -212.0 / 729.0;
+const double a61 = 9017.0 / 3168.0;
+const double a62 = -355.0 / 33.0;
+const double a63 = 46732.0 / 5247.0;
+const double a64 = 49.0 / 176.0;
+const double a65 = -5103.0 / 18656.0;
+
+// fifth order solution, the derivative at its end is the first stage of
+// the next step
+const double b1 = 35.0 / 384.0;
+const double b3 = 500.0 / 1113.0;
+const double b4 = 125.0 / 192.0;
+const double b5 = -2187.0 / 6784.0;
+const double b6 = 11.0 / 84.0;
+
+// difference between fifth and fourth order solution
+const double e1 = 71.0 / 57600.0;
+const double e3 = -71.0 / 16695.0;
+const double e4 = 71.0 / 1920.0;
+const double e5 = -17253.0 / 339200.0;
+const double e6 = 22.0 / 525.0;
+const double e7 = -1.0 / 40.0;
+
+//! Order used to scale the step size
+const double order = 5.0;
+
+/**
+ * Returns the factor by which to change the step size for the given
+ * ratio of error to tolerance. A factor below one rejects the step.
+ */
+inline double
+step_factor( const double rmax )
+{
+  if ( not( rmax <= 1.1 ) ) // also for NaN
+  {
+    return std::max( 0.2, 0.9 * std::pow( rmax, -1.0 / order ) );
+  }
+  if ( rmax < 0.5 )
+  {
+    return rmax > 0.0 ? std::min( 5.0, std::max( 1.0, 0.9 * std::pow( rmax, -1.0 / ( order + 1.0 ) ) ) ) : 5.0;
+  }
+  return 1.0;
+}
+}
+
+/**
+ * Adaptive Runge-Kutta integrator of order 5(4) for a system of N
+ * autonomous ordinary differential equations.
+ *
+ * The right-hand side is a functor f with a member
+ * @code
+ *   void operator()( const double y[], double dydt[] ) const;
+ * @endcode
+ * which is a template argument and can thus be inlined. The integrator
+ * holds only work space and no state between calls, so one instance can
+ * be kept per neuron or shared between neurons.
+ *
+ * integrate() advances the state from 0 to t1 with as many steps as
+ * needed, just like repeated calls to gsl_odeiv_evolve_apply. The step
+ * size h carries over between calls; the final step is cut to end at t1
+ * without changing h.
+ */
+template < size_t N >
+class DormandPrince
+{
+public:
+  DormandPrince( const double eps_abs, const double eps_rel )
+    : eps_abs_( eps_abs )
+    , eps_rel_( eps_rel )
+  {
+  }
+
+  /**
+   * Advances y from 0 to t1 and updates the step size h. Returns false
+   * if the step size vanished before t1 was reached.
+   */
+  template < typename Dynamics >
+  bool integrate( const Dynamics& f, const double t1, double& h, double y[] );
+
+private:
+  double eps_abs_;
+  double eps_rel_;
+
+  double k_[ 7 ][ N ]; //!< Derivatives at the stages
+  double ytmp_[ N ];   //!< Argument of the stages
+  double y5_[ N ];     //!< Fifth order solution of the trial step
+};
+
+template < size_t N >
+template < typename Dynamics >
+bool
+DormandPrince< N >::integrate( const Dynamics& f, const double t1, double& h, double y[] )
+{
+  using namespace dormand_prince;
+
+  double t = 0.0;
+  f( y, k_[ 0 ] );
+  while ( t < t1 )
+  {
+    const bool final_step = h >= t1 - t;
+    const double h0 = final_step ? t1 - t : h;
+
+    for ( size_t i = 0; i < N; ++i )
+    {
+      ytmp_[ i ] = y[ i ] + h0 * a21 * k_[ 0 ][ i ];
+    }
+    f( ytmp_, k_[ 1 ] );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      ytmp_[ i ] = y[ i ] + h0 * ( a31 * k_[ 0 ][ i ] + a32 * k_[ 1 ][ i ] );
+    }
+    f( ytmp_, k_[ 2 ] );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      ytmp_[ i ] = y[ i ] + h0 * ( a41 * k_[ 0 ][ i ] + a42 * k_[ 1 ][ i ] + a43 * k_[ 2 ][ i ] );
+    }
+    f( ytmp_, k_[ 3 ] );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      ytmp_[ i ] = y[ i ] + h0 * ( a51 * k_[ 0 ][ i ] + a52 * k_[ 1 ][ i ] + a53 * k_[ 2 ][ i ] + a54 * k_[ 3 ][ i ] );
+    }
+    f( ytmp_, k_[ 4 ] );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      ytmp_[ i ] = y[ i ]
+        + h0
+          * ( a61 * k_[ 0 ][ i ] + a62 * k_[ 1 ][ i ] + a63 * k_[ 2 ][ i ] + a64 * k_[ 3 ][ i ] + a65 * k_[ 4 ][ i ] );
+    }
+    f( ytmp_, k_[ 5 ] );
+    for ( size_t i = 0; i < N; ++i )
+    {
+      y5_[ i ] = y[ i ]
+        + h0 * ( b1 * k_[ 0 ][ i ] + b3 * k_[ 2 ][ i ] + b4 * k_[ 3 ][ i ] + b5 * k_[ 4 ][ i ] + b6 * k_[ 5 ][ i ] );
+    }
+    f( y5_, k_[ 6 ] );
+
+    double rmax = 0.0;
+    for ( size_t i = 0; i < N; ++i )
+    {
+      const double err = h0 * ( e1 * k_[ 0 ][ i ] + e3 * k_[ 2 ][ i ] + e4 * k_[ 3 ][ i ] + e5 * k_[ 4 ][ i ]
+                                + e6 * k_[ 5 ][ i ] + e7 * k_[ 6 ][ i ] );
+      const double r = std::abs( err ) / ( eps_abs_ + eps_rel_ * std::abs( y5_[ i ] ) );
+      rmax = r > rmax or r != r ? r : rmax; // keeps NaN
+    }
+
+    const double factor = step_factor( rmax );
+    if ( factor < 1.0 )
+    {
+      // retry with a smaller step from the same state
+      h = h0 * factor;
+      if ( t + h == t )
+      {
+        return false;
+      }
+      continue;
+    }
+
+    std::copy( y5_, y5_ + N, y );
+    std::copy( k_[ 6 ], k_[ 6 ] + N, k_[ 0 ] );
+    if ( final_step )
+    {
+      t = t1;
+    }
+    else
+    {
+      t += h0;
+      h = h0 * factor;
+    }
+  }
+  return true;
+}
+
+/**
+ * Adaptive Runge-Kutta integrator of order 5(4) for n systems of N
+ * autonomous ordinary differential equations, which are advanced
+ * together.
+ *
+ * Variable v of system i is stored at y[ v * n + i ], such that the
+ * loops over systems in each stage can be vectorized. The right-hand
+ * side is a functor f with a member
+ * @code
+ *   void operator()( const double y[], double dydt[], const size_t n ) const;
+ * @endcode
+ * that evaluates all n systems in the same layout.
+ *
+ * Each system keeps its own step size and time. All systems perform
+ * trial steps together until every system has reached t1; systems that
+ * have reached t1 take steps of size zero, which leave their state and
+ * step size unchanged. Each system thus takes exactly the steps that
+ * DormandPrince would take for it.
+ */
+template < size_t N >
+class BatchDormandPrince
+{
+public:
+  BatchDormandPrince( const double eps_abs, const double eps_rel )
+    : eps_abs_( eps_abs )
+    , eps_rel_( eps_rel )
+  {
+  }
+
+  /**
+   * Advances the n systems in y from 0 to t1 and updates their step
+   * sizes h. Returns false if the step size of any system vanished
+   * before t1 was reached.
+   */
+  template < typename Dynamics >
+  bool integrate( const Dynamics& f, const double t1, double h[], double y[], const size_t n );
+
+private:
+  double eps_abs_;
+  double eps_rel_;
+
+  std::vector< double > k_[ 7 ]; //!< Derivatives at the stages
+  std::vector< double > ytmp_;    //!< Argument of the stages
+  std::vector< double > y5_;      //!< Fifth order solutions of the trial steps
+  std::vector< double > t_;       //!< Time reached by each system
+  std::vector< double > h0_;      //!< Size of the trial steps
+  std::vector< double > final_;   //!< Whether the trial step ends at t1
+  std::vector< double > rmax_;    //!< Ratio of error to tolerance
+};
+
+template < size_t N >
+template < typename Dynamics >
+bool
+BatchDormandPrince< N >::integrate( const Dynamics& f,
+  const double t1,
+  double h[],
+  double y[],
+  const size_t n )
+{
+  using namespace dormand_prince;
+
+  if ( n == 0 )
+  {
+    return true;
+  }
+
+  for ( size_t s = 0; s < 7; ++s )
+  {
+    k_[ s ].resize( N * n );
+  }
+  ytmp_.resize( N * n );
+  y5_.resize( N * n );
+  t_.assign( n, 0.0 );
+  h0_.resize( n );
+  final_.resize( n );
+  rmax_.resize( n );
+
+  double* const k0 = &k_[ 0 ][ 0 ];
+  double* const k1 = &k_[ 1 ][ 0 ];
+  double* const k2 = &k_[ 2 ][ 0 ];
+  double* const k3 = &k_[ 3 ][ 0 ];
+  double* const k4 = &k_[ 4 ][ 0 ];
+  double* const k5 = &k_[ 5 ][ 0 ];
+  double* const k6 = &k_[ 6 ][ 0 ];
+  double* const ytmp = &ytmp_[ 0 ];
+  double* const y5 = &y5_[ 0 ];
+  double* const t = &t_[ 0 ];
+  double* const h0 = &h0_[ 0 ];
+  double* const final_step = &final_[ 0 ];
+  double* const rmax = &rmax_[ 0 ];
+
+  f( y, k0, n );
+  bool active = t1 > 0.0;
+  while ( active )
+  {
+#pragma omp simd
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const bool last = h[ i ] >= t1 - t[ i ];
+      h0[ i ] = last ? t1 - t[ i ] : h[ i ];
+      final_step[ i ] = last ? 1.0 : 0.0;
+    }
+
+    for ( size_t v = 0; v < N; ++v )
+    {
+#pragma omp simd
+      for ( size_t i = 0; i < n; ++i )
+      {
+        const size_t j = v * n + i;
+        ytmp[ j ] = y[ j ] + h0[ i ] * a21 * k0[ j ];
+      }
+    }
+    f( ytmp, k1, n );
+    for ( size_t v = 0; v < N; ++v )
+    {
+#pragma omp simd
+      for ( size_t i = 0; i < n; ++i )
+      {
+        const size_t j = v * n + i;
+        ytmp[ j ] = y[ j ] + h0[ i ] * ( a31 * k0[ j ] + a32 * k1[ j ] );
+      }
+    }
+    f( ytmp, k2, n );
+    for ( size_t v = 0; v < N; ++v )
+    {
+#pragma omp simd
+      for ( size_t i = 0; i < n; ++i )
+      {
+        const size_t j = v * n + i;
+        ytmp[ j ] = y[ j ] + h0[ i ] * ( a41 * k0[ j ] + a42 * k1[ j ] + a43 * k2[ j ] );
+      }
+    }
+    f( ytmp, k3, n );
+    for ( size_t v = 0; v < N; ++v )
+    {
+#pragma omp simd
+      for ( size_t i = 0; i < n; ++i )
+      {
+        const size_t j = v * n + i;
+        ytmp[ j ] = y[ j ] + h0[ i ] * ( a51 * k0[ j ] + a52 * k1[ j ] + a53 * k2[ j ] + a54 * k3[ j ] );
+      }
+    }
+    f( ytmp, k4, n );
+    for ( size_t v = 0; v < N; ++v )
+    {
+#pragma omp simd
+      for ( size_t i = 0; i < n; ++i )
+      {
+        const size_t j = v * n + i;
+        ytmp[ j ] =
+          y[ j ] + h0[ i ] * ( a61 * k0[ j ] + a62 * k1[ j ] + a63 * k2[ j ] + a64 * k3[ j ] + a65 * k4[ j ] );
+      }
+    }
+    f( ytmp, k5, n );
+    for ( size_t v = 0; v < N; ++v )
+    {
+#pragma omp simd
+      for ( size_t i = 0; i < n; ++i )
+      {
+        const size_t j = v * n + i;
+        y5[ j ] = y[ j ] + h0[ i ] * ( b1 * k0[ j ] + b3 * k2[ j ] + b4 * k3[ j ] + b5 * k4[ j ] + b6 * k5[ j ] );
+      }
+    }
+    f( y5, k6, n );
+
+    std::fill( rmax, rmax + n, 0.0 );
+    for ( size_t v = 0; v < N; ++v )
+    {
+#pragma omp simd
+      for ( size_t i = 0; i < n; ++i )
+      {
+        const size_t j = v * n + i;
+        const double err =
+          h0[ i ] * ( e1 * k0[ j ] + e3 * k2[ j ] + e4 * k3[ j ] + e5 * k4[ j ] + e6 * k5[ j ] + e7 * k6[ j ] );
+        const double r = std::abs( err ) / ( eps_abs_ + eps_rel_ * std::abs( y5[ j ] ) );
+        rmax[ i ] = r > rmax[ i ] or r != r ? r : rmax[ i ]; // keeps NaN
+      }
+    }
+
+    // accept or reject the trial step of each system that has not yet
+    // reached t1
+    active = false;
+    for ( size_t i = 0; i < n; ++i )
+    {
+      if ( t[ i ] >= t1 )
+      {
+        continue;
+      }
+
+      const double factor = step_factor( rmax[ i ] );
+      if ( factor < 1.0 )
+      {
+        h[ i ] = h0[ i ] * factor;
+        if ( t[ i ] + h[ i ] == t[ i ] )
+        {
+          return false;
+        }
+        active = true;
+        continue;
+      }
+
+      for ( size_t v = 0; v < N; ++v )
+      {
+        y[ v * n + i ] = y5[ v * n + i ];
+        k0[ v * n + i ] = k6[ v * n + i ];
+      }
+      if ( final_step[ i ] != 0.0 )
+      {
+        t[ i ] = t1;
+      }
+      else
+      {
+        t[ i ] += h0[ i ];
+        h[ i ] = h0[ i ] * factor;
+        active = true;
+      }
+    }
+  }
+  return true;
+}
+
+} // namespace nest
+
+#endif /* DORMAND_PRINCE_H */
@@ -23,7 +23,7 @@
 #include "event_delivery_manager.h"
 
 // C++ includes:
-#include <algorithm> // rotate
+#include <algorithm> // max, rotate, sort, upper_bound
 #include <iostream>
 #include <numeric> // accumulate
 
@@ -48,14 +48,31 @@ namespace nest
 {
 EventDeliveryManager::EventDeliveryManager()
   : off_grid_spiking_( false )
+  , pipelined_spike_exchange_( false )
+  , spike_exchange_split_( 0 )
+  , spike_exchange_in_flight_( false )
+  , sort_spike_delivery_( false )
+  , batch_spike_delivery_( false )
+  , sparse_spike_exchange_( false )
+  , sparse_target_data_exchange_( false )
+  , target_data_chunk_size_( 0 )
+  , spike_delivery_order_()
+  , pending_spikes_()
+  , spike_data_positions_()
+  , last_ended_rank_per_thread_()
+  , send_counts_spike_data_()
+  , recv_counts_spike_data_()
+  , send_displacements_spike_data_()
+  , recv_displacements_spike_data_()
   , moduli_()
   , slice_moduli_()
   , spike_register_()
   , off_grid_spike_register_()
   , send_buffer_secondary_events_()
   , recv_buffer_secondary_events_()
-  , time_collocate_( 0.0 )
-  , time_communicate_( 0.0 )
+  , timer_collocate_spike_data_()
+  , timer_communicate_spike_data_()
+  , timer_deliver_spike_data_()
   , local_spike_counter_()
   , send_buffer_spike_data_()
   , recv_buffer_spike_data_()
@@ -63,6 +80,12 @@ EventDeliveryManager::EventDeliveryManager()
   , recv_buffer_off_grid_spike_data_()
   , send_buffer_target_data_()
   , recv_buffer_target_data_()
+  , target_data_per_rank_()
+  , send_counts_target_data_()
+  , recv_counts_target_data_()
+  , send_counts_target_data_round_()
+  , recv_counts_target_data_round_()
+  , num_rounds_target_data_( 0 )
   , buffer_size_target_data_has_changed_( false )
   , buffer_size_spike_data_has_changed_( false )
   , gather_completed_checker_()
@@ -84,8 +107,20 @@ EventDeliveryManager::initialize()
   spike_register_.resize( num_threads );
   off_grid_spike_register_.resize( num_threads );
   gather_completed_checker_.resize( num_threads, false );
+  spike_delivery_order_.resize( num_threads );
+  pending_spikes_.resize( num_threads );
+  spike_data_positions_.resize( num_threads );
+  last_ended_rank_per_thread_.resize( num_threads, -1 );
   // Ensures that ResetKernel resets off_grid_spiking_
   off_grid_spiking_ = false;
+  pipelined_spike_exchange_ = false;
+  spike_exchange_split_ = 0;
+  spike_exchange_in_flight_ = false;
+  sort_spike_delivery_ = false;
+  batch_spike_delivery_ = false;
+  sparse_spike_exchange_ = false;
+  sparse_target_data_exchange_ = false;
+  target_data_chunk_size_ = 0;
   buffer_size_target_data_has_changed_ = false;
   buffer_size_spike_data_has_changed_ = false;
 
@@ -98,6 +133,8 @@ EventDeliveryManager::initialize()
     off_grid_spike_register_[ tid ].resize( num_threads,
       std::vector< std::vector< OffGridTarget > >( kernel().connection_manager.get_min_delay(),
                                               std::vector< OffGridTarget >() ) );
+
+    spike_data_positions_[ tid ].resize( num_threads );
   } // of omp parallel
 }
 
@@ -108,6 +145,19 @@ EventDeliveryManager::finalize()
   std::vector< std::vector< std::vector< std::vector< Target > > > >().swap( spike_register_ );
   std::vector< std::vector< std::vector< std::vector< OffGridTarget > > > >().swap( off_grid_spike_register_ );
   gather_completed_checker_.clear();
+  std::vector< std::vector< std::pair< uint64_t, unsigned int > > >().swap( spike_delivery_order_ );
+  std::vector< std::vector< PendingSpike > >().swap( pending_spikes_ );
+  std::vector< std::vector< std::vector< unsigned int > > >().swap( spike_data_positions_ );
+  last_ended_rank_per_thread_.clear();
+  send_counts_spike_data_.clear();
+  recv_counts_spike_data_.clear();
+  send_displacements_spike_data_.clear();
+  recv_displacements_spike_data_.clear();
+  std::vector< std::vector< TargetData > >().swap( target_data_per_rank_ );
+  send_counts_target_data_.clear();
+  recv_counts_target_data_.clear();
+  send_counts_target_data_round_.clear();
+  recv_counts_target_data_round_.clear();
 
   send_buffer_secondary_events_.clear();
   recv_buffer_secondary_events_.clear();
@@ -121,14 +171,44 @@ void
 EventDeliveryManager::set_status( const DictionaryDatum& dict )
 {
   updateValue< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
+  updateValue< bool >( dict, names::pipelined_spike_exchange, pipelined_spike_exchange_ );
+  updateValue< bool >( dict, names::sort_spike_delivery, sort_spike_delivery_ );
+  updateValue< bool >( dict, names::batch_spike_delivery, batch_spike_delivery_ );
+
+  const bool sparse_spike_exchange = sparse_spike_exchange_;
+  updateValue< bool >( dict, names::sparse_spike_exchange, sparse_spike_exchange_ );
+  if ( sparse_spike_exchange_ != sparse_spike_exchange and not send_buffer_spike_data_.empty() )
+  {
+    // buffers need to be restored to fixed-size chunks
+    resize_send_recv_buffers_spike_data_();
+  }
+
+  updateValue< bool >( dict, names::sparse_target_data_exchange, sparse_target_data_exchange_ );
+
+  long target_data_chunk_size = target_data_chunk_size_;
+  updateValue< long >( dict, names::target_data_chunk_size, target_data_chunk_size );
+  if ( target_data_chunk_size < 0 )
+  {
+    throw BadProperty( "target_data_chunk_size must be non-negative." );
+  }
+  target_data_chunk_size_ = target_data_chunk_size;
 }
 
 void
 EventDeliveryManager::get_status( DictionaryDatum& dict )
 {
   def< bool >( dict, names::off_grid_spiking, off_grid_spiking_ );
-  def< double >( dict, names::time_collocate, time_collocate_ );
-  def< double >( dict, names::time_communicate, time_communicate_ );
+  def< bool >( dict, names::pipelined_spike_exchange, pipelined_spike_exchange_ );
+  def< bool >( dict, names::sort_spike_delivery, sort_spike_delivery_ );
+  def< bool >( dict, names::batch_spike_delivery, batch_spike_delivery_ );
+  def< bool >( dict, names::sparse_spike_exchange, sparse_spike_exchange_ );
+  def< bool >( dict, names::sparse_target_data_exchange, sparse_target_data_exchange_ );
+  def< long >( dict, names::target_data_chunk_size, target_data_chunk_size_ );
+  def< double >( dict, names::time_collocate, timer_collocate_spike_data_.get_local_mean() );
+  def< double >( dict, names::time_communicate, timer_communicate_spike_data_.get_local_mean() );
+  timer_collocate_spike_data_.get_status( dict, names::time_collocate_spike_data );
+  timer_communicate_spike_data_.get_status( dict, names::time_communicate_spike_data );
+  timer_deliver_spike_data_.get_status( dict, names::time_deliver_spike_data );
   def< unsigned long >(
     dict, names::local_spike_counter, std::accumulate( local_spike_counter_.begin(), local_spike_counter_.end(), 0 ) );
 }
@@ -154,6 +234,14 @@ EventDeliveryManager::resize_send_recv_buffers_spike_data_()
   recv_buffer_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
   send_buffer_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
   recv_buffer_off_grid_spike_data_.resize( kernel().mpi_manager.get_buffer_size_spike_data() );
+
+  const unsigned int send_recv_count_spike_data_per_rank =
+    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
+  recv_displacements_spike_data_.resize( kernel().mpi_manager.get_num_processes() + 1 );
+  for ( size_t rank = 0; rank < recv_displacements_spike_data_.size(); ++rank )
+  {
+    recv_displacements_spike_data_[ rank ] = rank * send_recv_count_spike_data_per_rank;
+  }
 }
 
 void
@@ -259,8 +347,11 @@ EventDeliveryManager::update_moduli()
 void
 EventDeliveryManager::reset_timers_counters()
 {
-  time_collocate_ = 0.0;
-  time_communicate_ = 0.0;
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  timer_collocate_spike_data_.reset( num_threads );
+  timer_communicate_spike_data_.reset( num_threads );
+  timer_deliver_spike_data_.reset( num_threads );
+
   for ( std::vector< unsigned long >::iterator it = local_spike_counter_.begin(); it != local_spike_counter_.end();
         ++it )
   {
@@ -268,6 +359,14 @@ EventDeliveryManager::reset_timers_counters()
   }
 }
 
+void
+EventDeliveryManager::gather_timers()
+{
+  timer_collocate_spike_data_.gather();
+  timer_communicate_spike_data_.gather();
+  timer_deliver_spike_data_.gather();
+}
+
 void
 EventDeliveryManager::write_done_marker_secondary_events_( const bool done )
 {
@@ -297,13 +396,207 @@ EventDeliveryManager::deliver_secondary_events( const thread tid, const bool cal
 void
 EventDeliveryManager::gather_spike_data( const thread tid )
 {
-  if ( off_grid_spiking_ )
+  // deliver only at end of time slice
+  assert( kernel().simulation_manager.get_to_step() == kernel().connection_manager.get_min_delay() );
+
+  std::vector< Time > prepared_timestamps;
+  prepare_timestamps_( prepared_timestamps, kernel().simulation_manager.get_to_step() );
+
+  if ( sparse_spike_exchange_ and off_grid_spiking_ )
+  {
+    gather_spike_data_sparse_(
+      tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_, prepared_timestamps );
+  }
+  else if ( sparse_spike_exchange_ )
   {
-    gather_spike_data_( tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_ );
+    gather_spike_data_sparse_( tid, send_buffer_spike_data_, recv_buffer_spike_data_, prepared_timestamps );
+  }
+  else if ( off_grid_spiking_ )
+  {
+    gather_spike_data_(
+      tid, send_buffer_off_grid_spike_data_, recv_buffer_off_grid_spike_data_, prepared_timestamps );
   }
   else
   {
-    gather_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_ );
+    gather_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_, prepared_timestamps );
+  }
+}
+
+void
+EventDeliveryManager::prepare_timestamps_( std::vector< Time >& prepared_timestamps, const delay position ) const
+{
+  const delay min_delay = kernel().connection_manager.get_min_delay();
+  const bool second_part_from_previous_slice =
+    is_spike_exchange_pipelined() and position <= spike_exchange_split_;
+
+  prepared_timestamps.resize( min_delay );
+  for ( delay lag = 0; lag < min_delay; ++lag )
+  {
+    if ( second_part_from_previous_slice and lag >= spike_exchange_split_ )
+    {
+      prepared_timestamps[ lag ] = kernel().simulation_manager.get_previous_slice_origin() + Time::step( lag + 1 );
+    }
+    else
+    {
+      prepared_timestamps[ lag ] = kernel().simulation_manager.get_clock() + Time::step( lag + 1 );
+    }
+  }
+}
+
+void
+EventDeliveryManager::configure_spike_exchange_pipeline()
+{
+  spike_exchange_split_ = 0;
+
+  if ( not pipelined_spike_exchange_ )
+  {
+    return;
+  }
+
+  std::string reason;
+  if ( kernel().connection_manager.get_min_delay() < 2 )
+  {
+    reason = "the minimal delay is shorter than two simulation steps";
+  }
+  else if ( off_grid_spiking_ )
+  {
+    reason = "precise spike times are communicated";
+  }
+  else if ( sparse_spike_exchange_ )
+  {
+    reason = "the sparse spike exchange is used";
+  }
+  else if ( kernel().sp_manager.is_structural_plasticity_enabled() )
+  {
+    reason = "structural plasticity is enabled";
+  }
+  else if ( kernel().connection_manager.secondary_connections_exist() and kernel().node_manager.wfr_is_used() )
+  {
+    reason = "waveform relaxation is used";
+  }
+
+  if ( not reason.empty() )
+  {
+    LOG( M_WARNING,
+      "EventDeliveryManager::configure_spike_exchange_pipeline",
+      "Spike communication is not pipelined, since " + reason + "." );
+    return;
+  }
+
+  // Spikes emitted in the second part of a slice are delivered only
+  // after the first part of the next slice has been updated. They arrive
+  // at the earliest min_delay steps after emission, i.e., after the
+  // split step of the next slice.
+  spike_exchange_split_ = kernel().connection_manager.get_min_delay() / 2;
+}
+
+void
+EventDeliveryManager::exchange_spike_data_pipelined( const thread tid )
+{
+  assert( is_spike_exchange_pipelined() );
+
+  const delay to_step = kernel().simulation_manager.get_to_step();
+  assert( to_step == spike_exchange_split_ or to_step == kernel().connection_manager.get_min_delay() );
+
+  if ( spike_exchange_in_flight_ )
+  {
+    std::vector< Time > prepared_timestamps;
+    prepare_timestamps_( prepared_timestamps, to_step );
+    finish_spike_exchange_( tid, prepared_timestamps );
+  }
+
+  start_spike_exchange_( tid );
+}
+
+void
+EventDeliveryManager::complete_pipelined_spike_exchange( const thread tid )
+{
+  if ( not spike_exchange_in_flight_ )
+  {
+    return;
+  }
+
+  // called after the time has advanced, hence from_step is the current
+  // position within the slice
+  std::vector< Time > prepared_timestamps;
+  prepare_timestamps_( prepared_timestamps, kernel().simulation_manager.get_from_step() );
+  finish_spike_exchange_( tid, prepared_timestamps );
+}
+
+void
+EventDeliveryManager::start_spike_exchange_( const thread tid )
+{
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+  timer_collocate_spike_data_.start( tid );
+#pragma omp single
+  {
+    if ( kernel().mpi_manager.adaptive_spike_buffers() and buffer_size_spike_data_has_changed_ )
+    {
+      resize_send_recv_buffers_spike_data_();
+      buffer_size_spike_data_has_changed_ = false;
+    }
+  } // of omp single; implicit barrier
+
+  SendBufferPosition send_buffer_position(
+    assigned_ranks, kernel().mpi_manager.get_send_recv_count_spike_data_per_rank() );
+
+  const bool collocate_completed = collocate_spike_data_buffers_(
+    tid, assigned_ranks, send_buffer_position, spike_register_, send_buffer_spike_data_ );
+  gather_completed_checker_.set( tid, collocate_completed );
+
+#pragma omp barrier
+  set_end_and_invalid_markers_( assigned_ranks, send_buffer_position, send_buffer_spike_data_ );
+  clean_spike_register_( tid );
+
+  // Spikes which did not fit into the MPI buffer remain in the register
+  // and are communicated synchronously when this exchange is finished.
+  if ( gather_completed_checker_.all_true() )
+  {
+    set_complete_marker_spike_data_( assigned_ranks, send_buffer_position, send_buffer_spike_data_ );
+  }
+#pragma omp barrier
+  timer_collocate_spike_data_.stop( tid );
+
+  timer_communicate_spike_data_.start( tid );
+#pragma omp single
+  {
+    kernel().mpi_manager.communicate_spike_data_Ialltoall( send_buffer_spike_data_, recv_buffer_spike_data_ );
+    spike_exchange_in_flight_ = true;
+  } // of omp single; implicit barrier
+  timer_communicate_spike_data_.stop( tid );
+}
+
+void
+EventDeliveryManager::finish_spike_exchange_( const thread tid, const std::vector< Time >& prepared_timestamps )
+{
+  timer_communicate_spike_data_.start( tid );
+#pragma omp single
+  {
+    kernel().mpi_manager.wait_spike_data_Ialltoall();
+  } // of omp single; implicit barrier
+  timer_communicate_spike_data_.stop( tid );
+
+  timer_deliver_spike_data_.start( tid );
+  const bool deliver_completed = deliver_events_( tid, recv_buffer_spike_data_, prepared_timestamps );
+
+#pragma omp single
+  {
+    // all threads have read the flag at this point
+    spike_exchange_in_flight_ = false;
+
+    if ( not deliver_completed and kernel().mpi_manager.adaptive_spike_buffers() )
+    {
+      buffer_size_spike_data_has_changed_ = kernel().mpi_manager.increase_buffer_size_spike_data();
+    }
+  } // of omp single; implicit barrier
+  timer_deliver_spike_data_.stop( tid );
+
+  // All threads obtain the same result from the complete markers, so
+  // either all or none enter the synchronous rounds.
+  if ( not deliver_completed )
+  {
+    gather_spike_data_( tid, send_buffer_spike_data_, recv_buffer_spike_data_, prepared_timestamps );
   }
 }
 
@@ -311,7 +604,8 @@ template < typename SpikeDataT >
 void
 EventDeliveryManager::gather_spike_data_( const thread tid,
   std::vector< SpikeDataT >& send_buffer,
-  std::vector< SpikeDataT >& recv_buffer )
+  std::vector< SpikeDataT >& recv_buffer,
+  const std::vector< Time >& prepared_timestamps )
 {
   // Assume all threads have some work to do
   gather_completed_checker_.set( tid, false );
@@ -325,6 +619,7 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
     // otherwise
     gather_completed_checker_.set( tid, true );
 
+    timer_collocate_spike_data_.start( tid );
 #pragma omp single
     {
       if ( kernel().mpi_manager.adaptive_spike_buffers() and buffer_size_spike_data_has_changed_ )
@@ -364,8 +659,10 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
       set_complete_marker_spike_data_( assigned_ranks, send_buffer_position, send_buffer );
 #pragma omp barrier
     }
+    timer_collocate_spike_data_.stop( tid );
 
-// Communicate spikes using a single thread.
+    // Communicate spikes using a single thread.
+    timer_communicate_spike_data_.start( tid );
 #pragma omp single
     {
       if ( off_grid_spiking_ )
@@ -377,9 +674,11 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
         kernel().mpi_manager.communicate_spike_data_Alltoall( send_buffer, recv_buffer );
       }
     } // of omp single; implicit barrier
+    timer_communicate_spike_data_.stop( tid );
 
     // Deliver spikes from receive buffer to ring buffers.
-    const bool deliver_completed = deliver_events_( tid, recv_buffer );
+    timer_deliver_spike_data_.start( tid );
+    const bool deliver_completed = deliver_events_( tid, recv_buffer, prepared_timestamps );
     gather_completed_checker_.logical_and( tid, deliver_completed );
 
 // Exit gather loop if all local threads and remote processes are
@@ -394,12 +693,115 @@ EventDeliveryManager::gather_spike_data_( const thread tid,
       }
     }
 #pragma omp barrier
+    timer_deliver_spike_data_.stop( tid );
 
   } // of while
 
   reset_spike_register_( tid );
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::gather_spike_data_sparse_( const thread tid,
+  std::vector< SpikeDataT >& send_buffer,
+  std::vector< SpikeDataT >& recv_buffer,
+  const std::vector< Time >& prepared_timestamps )
+{
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+  timer_collocate_spike_data_.start( tid );
+#pragma omp single
+  {
+    send_counts_spike_data_.resize( kernel().mpi_manager.get_num_processes() );
+  } // of omp single; implicit barrier
+
+  // Each thread counts the spikes for the ranks assigned to it.
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    send_counts_spike_data_[ rank ] = 0;
+  }
+  count_spike_data_( tid, spike_register_ );
+  if ( off_grid_spiking_ )
+  {
+    count_spike_data_( tid, off_grid_spike_register_ );
+  }
+
+#pragma omp barrier
+#pragma omp single
+  {
+    send_displacements_spike_data_.resize( kernel().mpi_manager.get_num_processes() + 1 );
+    send_displacements_spike_data_[ 0 ] = 0;
+    for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+    {
+      send_displacements_spike_data_[ rank + 1 ] =
+        send_displacements_spike_data_[ rank ] + send_counts_spike_data_[ rank ];
+    }
+    // keep at least one entry, such that the buffer can be addressed
+    send_buffer.resize( std::max( send_displacements_spike_data_.back(), 1U ) );
+  } // of omp single; implicit barrier
+
+  // All spikes fit into the send buffer, hence a single round suffices.
+  SendBufferPosition send_buffer_position( assigned_ranks, send_displacements_spike_data_ );
+  collocate_spike_data_buffers_( tid, assigned_ranks, send_buffer_position, spike_register_, send_buffer );
+  if ( off_grid_spiking_ )
+  {
+    collocate_spike_data_buffers_( tid, assigned_ranks, send_buffer_position, off_grid_spike_register_, send_buffer );
+  }
+#pragma omp barrier
+  timer_collocate_spike_data_.stop( tid );
+
+  timer_communicate_spike_data_.start( tid );
+#pragma omp single
+  {
+    kernel().mpi_manager.communicate_Alltoall_counts( send_counts_spike_data_, recv_counts_spike_data_ );
+
+    recv_displacements_spike_data_.resize( kernel().mpi_manager.get_num_processes() + 1 );
+    recv_displacements_spike_data_[ 0 ] = 0;
+    for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+    {
+      recv_displacements_spike_data_[ rank + 1 ] =
+        recv_displacements_spike_data_[ rank ] + recv_counts_spike_data_[ rank ];
+    }
+    recv_buffer.resize( std::max( recv_displacements_spike_data_.back(), 1U ) );
+
+    kernel().mpi_manager.communicate_Alltoallv(
+      send_buffer, send_counts_spike_data_, recv_buffer, recv_counts_spike_data_ );
+  } // of omp single; implicit barrier
+  timer_communicate_spike_data_.stop( tid );
+
+  timer_deliver_spike_data_.start( tid );
+  deliver_events_( tid, recv_buffer, prepared_timestamps );
+#pragma omp barrier
+  timer_deliver_spike_data_.stop( tid );
+
+  reset_spike_register_( tid );
+}
+
+template < typename TargetT >
+void
+EventDeliveryManager::count_spike_data_( const thread tid,
+  const std::vector< std::vector< std::vector< std::vector< TargetT > > > >& spike_register )
+{
+  // First dimension: loop over writing thread
+  for ( typename std::vector< std::vector< std::vector< std::vector< TargetT > > > >::const_iterator it =
+          spike_register.begin();
+        it != spike_register.end();
+        ++it )
+  {
+    // Second dimension: fixed reading thread, which is assigned to the
+    // ranks of all entries
+    for ( typename std::vector< std::vector< TargetT > >::const_iterator iit = ( *it )[ tid ].begin();
+          iit != ( *it )[ tid ].end();
+          ++iit )
+    {
+      for ( typename std::vector< TargetT >::const_iterator iiit = iit->begin(); iiit != iit->end(); ++iiit )
+      {
+        ++send_counts_spike_data_[ iiit->get_rank() ];
+      }
+    }
+  }
+}
+
 template < typename TargetT, typename SpikeDataT >
 bool
 EventDeliveryManager::collocate_spike_data_buffers_( const thread tid,
@@ -498,8 +900,12 @@ EventDeliveryManager::reset_complete_marker_spike_data_( const AssignedRanks& as
 {
   for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
   {
-    const thread idx = send_buffer_position.end( rank ) - 1;
-    send_buffer[ idx ].reset_marker();
+    // chunks may be empty in the sparse spike exchange
+    if ( send_buffer_position.end( rank ) > send_buffer_position.begin( rank ) )
+    {
+      const thread idx = send_buffer_position.end( rank ) - 1;
+      send_buffer[ idx ].reset_marker();
+    }
   }
 }
 
@@ -519,75 +925,254 @@ EventDeliveryManager::set_complete_marker_spike_data_( const AssignedRanks& assi
 }
 
 template < typename SpikeDataT >
-bool
-EventDeliveryManager::deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer )
+void
+EventDeliveryManager::index_spike_data_( const thread tid, const std::vector< SpikeDataT >& recv_buffer )
 {
-  const unsigned int send_recv_count_spike_data_per_rank =
-    kernel().mpi_manager.get_send_recv_count_spike_data_per_rank();
-  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_synapse_prototypes( tid );
-
-  bool are_others_completed = true;
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  const size_t buffer_size = recv_displacements_spike_data_.back();
+  const bool use_compressed_spikes = kernel().connection_manager.use_compressed_spikes();
 
-  // deliver only at end of time slice
-  assert( kernel().simulation_manager.get_to_step() == kernel().connection_manager.get_min_delay() );
+  std::vector< std::vector< unsigned int > >& positions = spike_data_positions_[ tid ];
+  for ( std::vector< std::vector< unsigned int > >::iterator it = positions.begin(); it != positions.end(); ++it )
+  {
+    it->clear();
+  }
 
-  SpikeEvent se;
+  // contiguous slice of the receive buffer read by this thread; it may
+  // begin and end within the chunk of a rank
+  const unsigned int slice_begin = buffer_size * tid / num_threads;
+  const unsigned int slice_end = buffer_size * ( tid + 1 ) / num_threads;
 
-  // prepare Time objects for every possible time stamp within min_delay_
-  std::vector< Time > prepared_timestamps( kernel().connection_manager.get_min_delay() );
-  for ( size_t lag = 0; lag < ( size_t ) kernel().connection_manager.get_min_delay(); ++lag )
+  thread last_ended_rank = -1;
+  thread rank = std::upper_bound( recv_displacements_spike_data_.begin(), recv_displacements_spike_data_.end(), slice_begin )
+    - recv_displacements_spike_data_.begin() - 1;
+  unsigned int pos = slice_begin;
+  while ( pos < slice_end )
   {
-    prepared_timestamps[ lag ] = kernel().simulation_manager.get_clock() + Time::step( lag + 1 );
+    // skip empty chunks
+    while ( recv_displacements_spike_data_[ rank + 1 ] <= pos )
+    {
+      ++rank;
+    }
+    const unsigned int chunk_end = std::min( recv_displacements_spike_data_[ rank + 1 ], slice_end );
+
+    for ( ; pos < chunk_end; ++pos )
+    {
+      const SpikeDataT& spike_data = recv_buffer[ pos ];
+
+      // no spikes were sent by this rank
+      if ( spike_data.is_invalid_marker() )
+      {
+        last_ended_rank = rank;
+        break;
+      }
+
+      if ( use_compressed_spikes )
+      {
+        // a compressed spike is delivered by all threads that have
+        // targets of its source; slices may contain outdated entries,
+        // which are not delivered, but must not be expanded either
+        if ( kernel().connection_manager.is_valid_compressed_spike_data(
+               spike_data.get_syn_id(), spike_data.get_lcid() ) )
+        {
+          const std::vector< index >& lcids =
+            kernel().connection_manager.get_compressed_spike_data( spike_data.get_syn_id(), spike_data.get_lcid() );
+          for ( thread target_tid = 0; target_tid < num_threads; ++target_tid )
+          {
+            if ( lcids[ target_tid ] != invalid_index )
+            {
+              positions[ target_tid ].push_back( pos );
+            }
+          }
+        }
+      }
+      else
+      {
+        positions[ spike_data.get_tid() ].push_back( pos );
+      }
+
+      // this was the last valid entry from this rank
+      if ( spike_data.is_end_marker() )
+      {
+        last_ended_rank = rank;
+        break;
+      }
+    }
+
+    pos = chunk_end;
   }
 
-  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  last_ended_rank_per_thread_[ tid ] = last_ended_rank;
+}
+
+template < typename SpikeDataT >
+bool
+EventDeliveryManager::deliver_events_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const std::vector< Time >& prepared_timestamps )
+{
+  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_synapse_prototypes( tid );
+
+  // the sparse spike exchange always transmits all spikes at once
+  bool are_others_completed = true;
+
+  // check last entry for completed marker
+  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes() and not sparse_spike_exchange_; ++rank )
   {
-    // check last entry for completed marker; needs to be done before
-    // checking invalid marker to assure that this is always read
-    if ( not recv_buffer[ ( rank + 1 ) * send_recv_count_spike_data_per_rank - 1 ].is_complete_marker() )
+    if ( not recv_buffer[ recv_displacements_spike_data_[ rank + 1 ] - 1 ].is_complete_marker() )
     {
       are_others_completed = false;
     }
+  }
 
-    // continue with next rank if no spikes were sent by this rank
-    if ( recv_buffer[ rank * send_recv_count_spike_data_per_rank ].is_invalid_marker() )
-    {
-      continue;
-    }
+  // Each thread reads a slice of the receive buffer and sorts the
+  // positions of the spikes it finds by target thread, such that every
+  // thread afterwards only visits its own spikes.
+  index_spike_data_( tid, recv_buffer );
+#pragma omp barrier
 
-    for ( unsigned int i = 0; i < send_recv_count_spike_data_per_rank; ++i )
+  SpikeEvent se;
+  const bool use_compressed_spikes = kernel().connection_manager.use_compressed_spikes();
+
+  std::vector< std::pair< uint64_t, unsigned int > >& delivery_order = spike_delivery_order_[ tid ];
+  delivery_order.clear();
+
+  // batched delivery passes the sorted spikes to the connectors
+  const bool sort_spikes = sort_spike_delivery_ or batch_spike_delivery_;
+
+  // Slices are visited in order, such that spikes are delivered in the
+  // order in which they are stored in the receive buffer. A slice that
+  // begins within the chunk of a rank which ended in a previous slice
+  // contains outdated entries up to the end of this chunk.
+  thread last_ended_rank = -1;
+  for ( thread reading_tid = 0; reading_tid < kernel().vp_manager.get_num_threads(); ++reading_tid )
+  {
+    const unsigned int first_valid_pos = recv_displacements_spike_data_[ last_ended_rank + 1 ];
+    const std::vector< unsigned int >& positions = spike_data_positions_[ reading_tid ][ tid ];
+
+    for ( std::vector< unsigned int >::const_iterator it = positions.begin(); it != positions.end(); ++it )
     {
-      const SpikeDataT& spike_data = recv_buffer[ rank * send_recv_count_spike_data_per_rank + i ];
+      const unsigned int pos = *it;
+      if ( pos < first_valid_pos )
+      {
+        continue;
+      }
+
+      const SpikeDataT& spike_data = recv_buffer[ pos ];
+      const synindex syn_id = spike_data.get_syn_id();
+      const index lcid = use_compressed_spikes
+        ? kernel().connection_manager.get_compressed_spike_data( syn_id, spike_data.get_lcid() )[ tid ]
+        : spike_data.get_lcid();
 
-      if ( spike_data.get_tid() == tid )
+      if ( sort_spikes )
+      {
+        // delivered in deliver_sorted_events_ once all slices are read
+        delivery_order.push_back(
+          std::make_pair( get_spike_delivery_key_( syn_id, lcid, spike_data.get_lag() ), pos ) );
+      }
+      else
       {
         se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
         se.set_offset( spike_data.get_offset() );
 
-        const index syn_id = spike_data.get_syn_id();
-        const index lcid = spike_data.get_lcid();
         const index source_gid = kernel().connection_manager.get_source_gid( tid, syn_id, lcid );
         se.set_sender_gid( source_gid );
 
         kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
       }
-
-      // break if this was the last valid entry from this rank
-      if ( spike_data.is_end_marker() )
-      {
-        break;
-      }
     }
+
+    last_ended_rank = std::max( last_ended_rank, last_ended_rank_per_thread_[ reading_tid ] );
+  }
+
+  if ( sort_spikes )
+  {
+    deliver_sorted_events_( tid, recv_buffer, prepared_timestamps );
   }
 
   return are_others_completed;
 }
 
+template < typename SpikeDataT >
+void
+EventDeliveryManager::deliver_sorted_events_( const thread tid,
+  const std::vector< SpikeDataT >& recv_buffer,
+  const std::vector< Time >& prepared_timestamps )
+{
+  std::vector< std::pair< uint64_t, unsigned int > >& delivery_order = spike_delivery_order_[ tid ];
+
+  // The key includes the lag and ties are broken by the position in the
+  // receive buffer, such that each connection receives its spikes in
+  // temporal order and the delivery order is deterministic.
+  std::sort( delivery_order.begin(), delivery_order.end() );
+
+  const std::vector< ConnectorModel* >& cm = kernel().model_manager.get_synapse_prototypes( tid );
+
+  std::vector< PendingSpike >& pending = pending_spikes_[ tid ];
+  pending.clear();
+
+  SpikeEvent se;
+  synindex previous_syn_id = invalid_synindex;
+  index previous_lcid = invalid_index;
+  for ( std::vector< std::pair< uint64_t, unsigned int > >::const_iterator it = delivery_order.begin();
+        it != delivery_order.end();
+        ++it )
+  {
+    // the key holds the local connection id, which differs from the
+    // one in the receive buffer for compressed spikes
+    const synindex syn_id = get_spike_delivery_syn_id_( it->first );
+    const index lcid = get_spike_delivery_lcid_( it->first );
+
+    // sending the batch changes the stamp, offset and sender of se
+    if ( batch_spike_delivery_ and syn_id != previous_syn_id and not pending.empty() )
+    {
+      kernel().connection_manager.send_batch(
+        tid, previous_syn_id, &pending[ 0 ], &pending[ 0 ] + pending.size(), cm, se );
+      pending.clear();
+    }
+
+    const SpikeDataT& spike_data = recv_buffer[ it->second ];
+    se.set_stamp( prepared_timestamps[ spike_data.get_lag() ] );
+    se.set_offset( spike_data.get_offset() );
+
+    // consecutive spikes through the same connection share their source
+    if ( syn_id != previous_syn_id or lcid != previous_lcid )
+    {
+      se.set_sender_gid( kernel().connection_manager.get_source_gid( tid, syn_id, lcid ) );
+      previous_syn_id = syn_id;
+      previous_lcid = lcid;
+    }
+
+    if ( batch_spike_delivery_ )
+    {
+      const PendingSpike spike = { lcid, se.get_sender_gid(), se.get_stamp(), se.get_offset() };
+      pending.push_back( spike );
+    }
+    else
+    {
+      kernel().connection_manager.send( tid, syn_id, lcid, cm, se );
+    }
+  }
+
+  if ( not pending.empty() )
+  {
+    kernel().connection_manager.send_batch(
+      tid, previous_syn_id, &pending[ 0 ], &pending[ 0 ] + pending.size(), cm, se );
+    pending.clear();
+  }
+}
+
 void
 EventDeliveryManager::gather_target_data( const thread tid )
 {
   assert( not kernel().connection_manager.is_source_table_cleared() );
 
+  if ( sparse_target_data_exchange_ )
+  {
+    gather_target_data_sparse_( tid );
+    return;
+  }
+
   // assume all threads have some work to do
   gather_completed_checker_.set( tid, false );
   assert( gather_completed_checker_.all_false() );
@@ -784,6 +1369,148 @@ nest::EventDeliveryManager::distribute_target_data_buffers_( const thread tid )
   return are_others_completed;
 }
 
+void
+EventDeliveryManager::gather_target_data_sparse_( const thread tid )
+{
+  const AssignedRanks assigned_ranks = kernel().vp_manager.get_assigned_ranks( tid );
+
+  kernel().connection_manager.prepare_target_table( tid );
+  kernel().connection_manager.reset_source_table_entry_point( tid );
+  kernel().connection_manager.restore_source_table_entry_point( tid );
+
+#pragma omp single
+  {
+    target_data_per_rank_.resize( kernel().mpi_manager.get_num_processes() );
+    send_counts_target_data_.resize( kernel().mpi_manager.get_num_processes() );
+    send_counts_target_data_round_.resize( kernel().mpi_manager.get_num_processes() );
+    recv_counts_target_data_round_.resize( kernel().mpi_manager.get_num_processes() );
+  } // of omp single; implicit barrier
+
+  // Each thread collects all TargetData for the ranks assigned to it,
+  // hence the whole source table is read in a single pass.
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    target_data_per_rank_[ rank ].clear();
+  }
+
+  if ( assigned_ranks.begin == assigned_ranks.end )
+  {
+    kernel().connection_manager.no_targets_to_process( tid );
+  }
+  else
+  {
+    thread source_rank;
+    TargetData next_target_data;
+    while ( kernel().connection_manager.get_next_target_data(
+      tid, assigned_ranks.begin, assigned_ranks.end, source_rank, next_target_data ) )
+    {
+      target_data_per_rank_[ source_rank ].push_back( next_target_data );
+    }
+  }
+
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    send_counts_target_data_[ rank ] = target_data_per_rank_[ rank ].size();
+  }
+#pragma omp barrier
+
+  kernel().connection_manager.clear_source_table( tid );
+
+#pragma omp single
+  {
+    kernel().mpi_manager.communicate_Alltoall_counts( send_counts_target_data_, recv_counts_target_data_ );
+
+    // all ranks need to take part in the same number of rounds
+    const long max_send_count = *std::max_element( send_counts_target_data_.begin(), send_counts_target_data_.end() );
+    std::vector< long > global_max_send_count( kernel().mpi_manager.get_num_processes() );
+    global_max_send_count[ kernel().mpi_manager.get_rank() ] = max_send_count;
+    kernel().mpi_manager.communicate( global_max_send_count );
+    const long max_count = *std::max_element( global_max_send_count.begin(), global_max_send_count.end() );
+
+    if ( target_data_chunk_size_ == 0 or max_count <= target_data_chunk_size_ )
+    {
+      num_rounds_target_data_ = 1;
+    }
+    else
+    {
+      num_rounds_target_data_ = ( max_count + target_data_chunk_size_ - 1 ) / target_data_chunk_size_;
+    }
+  } // of omp single; implicit barrier
+
+  for ( size_t round = 0; round < num_rounds_target_data_; ++round )
+  {
+#pragma omp single
+    {
+      // determine the part of the TargetData for each rank that is
+      // exchanged in this round
+      size_t send_size = 0;
+      size_t recv_size = 0;
+      for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+      {
+        const long offset = round * target_data_chunk_size_;
+        if ( num_rounds_target_data_ == 1 )
+        {
+          send_counts_target_data_round_[ rank ] = send_counts_target_data_[ rank ];
+          recv_counts_target_data_round_[ rank ] = recv_counts_target_data_[ rank ];
+        }
+        else
+        {
+          send_counts_target_data_round_[ rank ] =
+            std::max( 0L, std::min( target_data_chunk_size_, send_counts_target_data_[ rank ] - offset ) );
+          recv_counts_target_data_round_[ rank ] =
+            std::max( 0L, std::min( target_data_chunk_size_, recv_counts_target_data_[ rank ] - offset ) );
+        }
+        send_size += send_counts_target_data_round_[ rank ];
+        recv_size += recv_counts_target_data_round_[ rank ];
+      }
+
+      // keep at least one entry, such that the buffers can be addressed
+      send_buffer_target_data_.resize( std::max( send_size, static_cast< size_t >( 1 ) ) );
+      recv_buffer_target_data_.resize( std::max( recv_size, static_cast< size_t >( 1 ) ) );
+
+      size_t position = 0;
+      for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+      {
+        const std::vector< TargetData >::const_iterator first =
+          target_data_per_rank_[ rank ].begin() + round * target_data_chunk_size_;
+        std::copy( first, first + send_counts_target_data_round_[ rank ], send_buffer_target_data_.begin() + position );
+        position += send_counts_target_data_round_[ rank ];
+      }
+
+      kernel().mpi_manager.communicate_Alltoallv( send_buffer_target_data_,
+        send_counts_target_data_round_,
+        recv_buffer_target_data_,
+        recv_counts_target_data_round_ );
+    } // of omp single; implicit barrier
+
+    distribute_target_data_sparse_( tid );
+#pragma omp barrier
+  }
+
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    std::vector< TargetData >().swap( target_data_per_rank_[ rank ] );
+  }
+}
+
+void
+EventDeliveryManager::distribute_target_data_sparse_( const thread tid )
+{
+  size_t position = 0;
+  for ( thread rank = 0; rank < kernel().mpi_manager.get_num_processes(); ++rank )
+  {
+    for ( int i = 0; i < recv_counts_target_data_round_[ rank ]; ++i )
+    {
+      const TargetData& target_data = recv_buffer_target_data_[ position + i ];
+      if ( target_data.get_source_tid() == tid )
+      {
+        kernel().connection_manager.add_target( tid, rank, target_data );
+      }
+    }
+    position += recv_counts_target_data_round_[ rank ];
+  }
+}
+
 void
 EventDeliveryManager::resize_spike_register_( const thread tid )
 {
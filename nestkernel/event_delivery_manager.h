@@ -26,6 +26,7 @@
 // C++ includes:
 #include <cassert>
 #include <limits>
+#include <utility>
 #include <vector>
 
 // Includes from libnestutil:
@@ -39,6 +40,7 @@
 #include "nest_time.h"
 #include "nest_types.h"
 #include "node.h"
+#include "phase_timer.h"
 #include "target_table.h"
 #include "spike_data.h"
 #include "vp_manager.h"
@@ -204,12 +206,52 @@ public:
    */
   void gather_spike_data( const thread tid );
 
+  /**
+   * Determines whether spike communication can be overlapped with the
+   * update of nodes and, if so, at which step each slice is split.
+   * Needs to be called at the end of SimulationManager::prepare().
+   */
+  void configure_spike_exchange_pipeline();
+
+  /**
+   * Returns the step at which each time slice is split if spike
+   * communication is pipelined, and zero otherwise.
+   */
+  delay get_spike_exchange_split() const;
+
+  /**
+   * Returns whether spike communication is overlapped with the update of
+   * nodes.
+   */
+  bool is_spike_exchange_pipelined() const;
+
+  /**
+   * Pipelined counterpart of gather_spike_data(). Waits for the spike
+   * exchange started at the previous exchange point, delivers the
+   * received spikes, and starts a non-blocking exchange of all spikes
+   * in the register. Called at the split step and at the end of each
+   * slice.
+   */
+  void exchange_spike_data_pipelined( const thread tid );
+
+  /**
+   * Waits for and delivers a pending pipelined spike exchange. Needs to
+   * be called at the end of each run.
+   */
+  void complete_pipelined_spike_exchange( const thread tid );
+
   /**
    * Collocates presynaptic connection information, communicates via
    * MPI and creates presynaptic connection infrastructure.
    */
   void gather_target_data( const thread tid );
 
+  /**
+   * Returns whether connection information is exchanged in the sparse
+   * mode, which allocates its MPI buffers during the exchange.
+   */
+  bool is_target_data_exchange_sparse() const;
+
   /**
    * Collocates presynaptic connection information for secondary events (MPI
    * buffer offsets), communicates via MPI and create presynaptic connection
@@ -241,11 +283,58 @@ public:
    */
   virtual void reset_timers_counters();
 
+  /**
+   * Collect the time measurements of all threads across MPI processes.
+   * Must be called by all MPI processes after a run.
+   */
+  void gather_timers();
+
 private:
   template < typename SpikeDataT >
   void gather_spike_data_( const thread tid,
     std::vector< SpikeDataT >& send_buffer,
-    std::vector< SpikeDataT >& recv_buffer );
+    std::vector< SpikeDataT >& recv_buffer,
+    const std::vector< Time >& prepared_timestamps );
+
+  /**
+   * Exchanges spikes with chunks sized to the number of spikes for each
+   * rank, using Alltoallv. The number of spikes is communicated first,
+   * hence all spikes are exchanged in a single round.
+   */
+  template < typename SpikeDataT >
+  void gather_spike_data_sparse_( const thread tid,
+    std::vector< SpikeDataT >& send_buffer,
+    std::vector< SpikeDataT >& recv_buffer,
+    const std::vector< Time >& prepared_timestamps );
+
+  /**
+   * Adds the number of spikes in the register for each rank assigned to
+   * thread tid to send_counts_spike_data_.
+   */
+  template < typename TargetT >
+  void count_spike_data_( const thread tid,
+    const std::vector< std::vector< std::vector< std::vector< TargetT > > > >& spike_register );
+
+  /**
+   * Collocates all spikes in the register into the MPI buffer and
+   * starts a non-blocking exchange.
+   */
+  void start_spike_exchange_( const thread tid );
+
+  /**
+   * Waits for the pending non-blocking exchange and delivers the
+   * received spikes. Falls back to synchronous communication rounds if
+   * not all spikes fitted into the MPI buffers.
+   */
+  void finish_spike_exchange_( const thread tid, const std::vector< Time >& prepared_timestamps );
+
+  /**
+   * Prepares Time objects for every possible lag within min_delay. In
+   * pipelined mode, spikes with lags beyond the split step are stamped
+   * relative to the previous slice as long as the current slice has not
+   * advanced beyond the split step.
+   */
+  void prepare_timestamps_( std::vector< Time >& prepared_timestamps, const delay position ) const;
 
   void resize_send_recv_buffers_spike_data_();
 
@@ -286,12 +375,51 @@ private:
     const SendBufferPosition& send_buffer_position,
     std::vector< SpikeDataT >& send_buffer ) const;
 
+  /**
+   * Reads a slice of the receive buffer and stores the positions of
+   * the spikes it contains in spike_data_positions_, separately for
+   * each target thread.
+   */
+  template < typename SpikeDataT >
+  void index_spike_data_( const thread tid, const std::vector< SpikeDataT >& recv_buffer );
+
   /**
    * Reads spikes from MPI buffers and delivers them to ringbuffer of
-   * nodes.
+   * nodes. Needs to be called by all threads, since the receive buffer
+   * is indexed in parallel.
    */
   template < typename SpikeDataT >
-  bool deliver_events_( const thread tid, const std::vector< SpikeDataT >& recv_buffer );
+  bool deliver_events_( const thread tid,
+    const std::vector< SpikeDataT >& recv_buffer,
+    const std::vector< Time >& prepared_timestamps );
+
+  /**
+   * Delivers the spikes of thread tid, which deliver_events_ collected
+   * in spike_delivery_order_, ordered by synapse type and connection,
+   * such that connections are visited in memory order. In batched
+   * delivery, the spikes of each synapse type are collected in
+   * pending_spikes_ and passed to the connector in one call.
+   */
+  template < typename SpikeDataT >
+  void deliver_sorted_events_( const thread tid,
+    const std::vector< SpikeDataT >& recv_buffer,
+    const std::vector< Time >& prepared_timestamps );
+
+  /**
+   * Returns a key that orders spikes by synapse type, local connection
+   * index and lag.
+   */
+  static uint64_t get_spike_delivery_key_( const synindex syn_id, const index lcid, const unsigned int lag );
+
+  /**
+   * Returns the synapse-type index encoded in a spike delivery key.
+   */
+  static synindex get_spike_delivery_syn_id_( const uint64_t key );
+
+  /**
+   * Returns the local connection index encoded in a spike delivery key.
+   */
+  static index get_spike_delivery_lcid_( const uint64_t key );
 
   /**
    * Deletes all spikes from spike registers and resets spike
@@ -343,6 +471,22 @@ private:
    */
   bool distribute_target_data_buffers_( const thread tid );
 
+  /**
+   * Counterpart of gather_target_data() for the sparse target data
+   * exchange. Collects all TargetData objects for the ranks assigned to
+   * thread tid first, exchanges their exact number and then
+   * communicates them in a single round of Alltoallv, or in rounds of at
+   * most target_data_chunk_size entries per pair of ranks.
+   */
+  void gather_target_data_sparse_( const thread tid );
+
+  /**
+   * Reads all TargetData objects that were received in the last round
+   * of the sparse target data exchange and creates Target objects on
+   * TargetTable for the sources on thread tid.
+   */
+  void distribute_target_data_sparse_( const thread tid );
+
   /**
    * Sends event e to all targets of node source. Delivers events from
    * devices directly to targets.
@@ -355,6 +499,70 @@ private:
   bool off_grid_spiking_; //!< indicates whether spikes are not constrained to
                           //!< the grid
 
+  bool pipelined_spike_exchange_; //!< whether the user requested to overlap
+                                  //!< spike communication with node updates
+
+  delay spike_exchange_split_; //!< step at which slices are split in
+                               //!< pipelined mode, zero otherwise
+
+  bool spike_exchange_in_flight_; //!< whether a non-blocking spike exchange
+                                  //!< has been started but not completed
+
+  bool sort_spike_delivery_; //!< whether spikes are sorted by connection
+                             //!< before delivery
+
+  bool batch_spike_delivery_; //!< whether sorted spikes are passed to
+                              //!< each connector in a single batch
+
+  bool sparse_spike_exchange_; //!< whether spikes are exchanged with
+                               //!< Alltoallv in chunks of exact size
+
+  bool sparse_target_data_exchange_; //!< whether connection information is
+                                     //!< exchanged with Alltoallv after
+                                     //!< communicating its exact size
+
+  long target_data_chunk_size_; //!< maximal number of TargetData per pair
+                                //!< of ranks in one round of the sparse
+                                //!< target data exchange, or zero
+
+  /**
+   * Per-thread list of the spikes to be delivered by each thread, as
+   * pairs of sort key and position in the receive buffer. Kept across
+   * calls to avoid reallocation.
+   */
+  std::vector< std::vector< std::pair< uint64_t, unsigned int > > > spike_delivery_order_;
+
+  /**
+   * Per-thread list of the sorted spikes of one synapse type in batched
+   * delivery. Kept across calls to avoid reallocation.
+   */
+  std::vector< std::vector< PendingSpike > > pending_spikes_;
+
+  /**
+   * Positions in the receive buffer of the spikes found by each thread
+   * in its slice of the buffer, for each target thread.
+   */
+  std::vector< std::vector< std::vector< unsigned int > > > spike_data_positions_;
+
+  /**
+   * For each thread, the last rank whose chunk in the receive buffer
+   * ended within the slice read by this thread, or -1.
+   */
+  std::vector< thread > last_ended_rank_per_thread_;
+
+  //! number of spikes sent to and received from each rank in the sparse
+  //! spike exchange
+  std::vector< int > send_counts_spike_data_;
+  std::vector< int > recv_counts_spike_data_;
+
+  /**
+   * Position of the first entry of each rank in the send and receive
+   * buffers for spikes, followed by the total number of entries. Chunks
+   * have fixed size, unless the sparse spike exchange is used.
+   */
+  std::vector< unsigned int > send_displacements_spike_data_;
+  std::vector< unsigned int > recv_displacements_spike_data_;
+
   /**
    * Table of pre-computed modulos.
    * This table is used to map time steps, given as offset from now,
@@ -412,13 +620,19 @@ private:
    * Time that was spent on collocation of MPI buffers during the last call to
    * simulate.
    */
-  double time_collocate_;
+  PhaseTimer timer_collocate_spike_data_;
 
   /**
-   * Time that was spent on communication of events during the last call to
-   * simulate.
+   * Time that was spent on communication of spikes during the last call to
+   * simulate, including the wait for other threads and processes.
    */
-  double time_communicate_;
+  PhaseTimer timer_communicate_spike_data_;
+
+  /**
+   * Time that was spent on delivery of spikes to their targets during the
+   * last call to simulate.
+   */
+  PhaseTimer timer_deliver_spike_data_;
 
   /**
    * Number of generated spike events (both off- and on-grid) during the last
@@ -433,6 +647,22 @@ private:
 
   std::vector< TargetData > send_buffer_target_data_;
   std::vector< TargetData > recv_buffer_target_data_;
+
+  /**
+   * TargetData objects collected for each rank in the sparse target data
+   * exchange. Each thread only writes to the ranks assigned to it.
+   */
+  std::vector< std::vector< TargetData > > target_data_per_rank_;
+
+  //! number of TargetData sent to and received from each rank in total
+  //! and in the current round of the sparse target data exchange
+  std::vector< int > send_counts_target_data_;
+  std::vector< int > recv_counts_target_data_;
+  std::vector< int > send_counts_target_data_round_;
+  std::vector< int > recv_counts_target_data_round_;
+
+  //! number of rounds of the sparse target data exchange
+  size_t num_rounds_target_data_;
   //!< whether size of MPI buffer for communication of connections was changed
   bool buffer_size_target_data_has_changed_;
   //!< whether size of MPI buffer for communication of spikes was changed
@@ -505,6 +735,25 @@ EventDeliveryManager::send_to_node( Event& e )
   e();
 }
 
+inline uint64_t
+EventDeliveryManager::get_spike_delivery_key_( const synindex syn_id, const index lcid, const unsigned int lag )
+{
+  return ( ( static_cast< uint64_t >( syn_id ) << NUM_BITS_LCID | static_cast< uint64_t >( lcid ) ) << NUM_BITS_LAG )
+    | lag;
+}
+
+inline synindex
+EventDeliveryManager::get_spike_delivery_syn_id_( const uint64_t key )
+{
+  return key >> ( NUM_BITS_LCID + NUM_BITS_LAG );
+}
+
+inline index
+EventDeliveryManager::get_spike_delivery_lcid_( const uint64_t key )
+{
+  return ( key >> NUM_BITS_LAG ) & MAX_LCID;
+}
+
 inline bool
 EventDeliveryManager::get_off_grid_communication() const
 {
@@ -517,6 +766,24 @@ EventDeliveryManager::set_off_grid_communication( bool off_grid_spiking )
   off_grid_spiking_ = off_grid_spiking;
 }
 
+inline delay
+EventDeliveryManager::get_spike_exchange_split() const
+{
+  return spike_exchange_split_;
+}
+
+inline bool
+EventDeliveryManager::is_spike_exchange_pipelined() const
+{
+  return spike_exchange_split_ > 0;
+}
+
+inline bool
+EventDeliveryManager::is_target_data_exchange_sparse() const
+{
+  return sparse_target_data_exchange_;
+}
+
 inline size_t
 EventDeliveryManager::read_toggle() const
 {
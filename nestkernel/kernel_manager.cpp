@@ -158,6 +158,9 @@ nest::KernelManager::change_num_threads( size_t num_threads )
   event_delivery_manager.initialize();
   music_manager.initialize();
   node_manager.initialize();
+
+  // the construction timers keep one stopwatch per thread
+  simulation_manager.reset_connection_infrastructure_timers();
 }
 
 void
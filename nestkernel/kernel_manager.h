@@ -69,6 +69,37 @@
  num_processes                 integertype - The number of MPI processes (read only)
  off_grid_spiking              booltype    - Whether to transmit precise spike times in MPI
                                              communication (read only)
+ pipelined_spike_exchange      booltype    - Whether to overlap spike communication with the
+                                             update of nodes; requires min_delay of at least
+                                             two simulation steps
+ population_update             booltype    - Whether to update all neurons of a model on each thread
+                                             together in vectorized loops, for the models that
+                                             support it (iaf_psc_alpha, iaf_psc_delta, iaf_psc_exp);
+                                             takes effect at the next call to Prepare or Simulate
+ fast_forward_quiescent        booltype    - Whether neurons without input advance over the steps
+                                             until their next input in closed form, for the models
+                                             that support it (iaf_psc_delta, iaf_psc_exp); results
+                                             differ from step-wise updates by rounding errors
+ sort_spike_delivery           booltype    - Whether each thread sorts received spikes by synapse
+                                             type and connection before delivering them
+ batch_spike_delivery          booltype    - Whether each thread sorts received spikes like
+                                             sort_spike_delivery and passes all spikes of a
+                                             synapse type to its connections in one batch, such
+                                             that plastic synapses update their weights in a
+                                             single pass over the connections; results are
+                                             identical to sorted delivery
+ sparse_spike_exchange         booltype    - Whether to exchange spikes with Alltoallv, sending
+                                             exactly the spikes for each process in a single round
+ sparse_target_data_exchange   booltype    - Whether to build the connection infrastructure by
+                                             exchanging the exact number of connection entries
+                                             for each process first and then all entries with
+                                             Alltoallv, instead of in rounds of fixed-size buffers
+ target_data_chunk_size        integertype - Maximal number of connection entries per pair of
+                                             processes in one round of the sparse exchange; zero
+                                             exchanges all entries in a single round
+ use_compressed_spikes         booltype    - Whether to send each spike only once per synapse type
+                                             and target process, instead of once per target thread;
+                                             can only be changed before connections are created
 
  Connector configuration
  initial_connector_capacity    integertype - When a connector is first created, it starts with this
@@ -106,6 +137,36 @@
  wfr_max_iterations            integertype - Maximal number of iterations used for waveform relaxation
  wfr_interpolation_order       integertype - Interpolation order of polynomial used in wfr iterations
 
+ Profiling
+ The following entries describe the last call to Simulate or Run. Apart from
+ time_collocate and time_communicate, each is a dictionary with the times of
+ the local threads (per_thread), the mean time of each MPI process (per_rank)
+ and the minimum, maximum and mean across all threads of all processes (in s).
+ time_update                   dictionarytype - Update of nodes
+ time_wfr                      dictionarytype - Waveform relaxation iterations
+ time_secondary_events         dictionarytype - Exchange and delivery of secondary events
+ time_collocate_spike_data     dictionarytype - Collocation of spikes in MPI buffers
+ time_communicate_spike_data   dictionarytype - MPI communication of spikes
+ time_deliver_spike_data       dictionarytype - Delivery of spikes to their targets
+ time_omp_synchronization      dictionarytype - Waiting for other threads in the update loop
+ time_collocate                doubletype  - Mean collocation time of the local threads (read only)
+ time_communicate              doubletype  - Mean communication time of the local threads (read only)
+ The following entries accumulate the time spent building the connection
+ infrastructure since the last ResetKernel. They are collected across
+ processes at the end of each call to Prepare and Run.
+ time_sort_connections         dictionarytype - Sorting of connections by source
+ time_prepare_connection_infrastructure
+                               dictionarytype - Sizing of MPI buffers and tables
+ time_gather_target_data       dictionarytype - Exchange of connection information
+                                                and creation of target tables
+ measure_update_cost           booltype    - Whether to measure the update cost of each node
+ update_cost                   dictionarytype - Update cost of the nodes of the local threads
+                                                (per_thread, in s) since measure_update_cost
+                                                was set or nodes were added, and the ratio of
+                                                maximal to mean cost per virtual process for
+                                                the current (imbalance) and for a cost-balanced
+                                                distribution of nodes (balanced_imbalance)
+
  Miscellaneous
  dict_miss_is_error            booltype    - Whether missed dictionary entries are treated as errors
 
@@ -73,6 +73,7 @@ nest::MPIManager::MPIManager()
 #ifdef HAVE_MPI
   , comm_step_( std::vector< int >() )
   , COMM_OVERFLOW_ERROR( std::numeric_limits< unsigned int >::max() )
+  , spike_data_request_( MPI_REQUEST_NULL )
   , comm( 0 )
   , MPI_OFFGRID_SPIKE( 0 )
 #endif
@@ -669,6 +670,60 @@ nest::MPIManager::communicate_Alltoall_( void* send_buffer, void* recv_buffer, c
   MPI_Alltoall( send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm );
 }
 
+void
+nest::MPIManager::communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count )
+{
+  assert( spike_data_request_ == MPI_REQUEST_NULL );
+#if MPI_VERSION >= 3
+  MPI_Ialltoall( send_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    recv_buffer,
+    send_recv_count,
+    MPI_UNSIGNED,
+    comm,
+    &spike_data_request_ );
+#else
+  // non-blocking collectives require MPI 3; fall back to blocking
+  // communication, the request remains MPI_REQUEST_NULL
+  MPI_Alltoall( send_buffer, send_recv_count, MPI_UNSIGNED, recv_buffer, send_recv_count, MPI_UNSIGNED, comm );
+#endif
+}
+
+void
+nest::MPIManager::communicate_Alltoallv_( void* send_buffer,
+  const std::vector< int >& send_counts,
+  const std::vector< int >& send_displacements,
+  void* recv_buffer,
+  const std::vector< int >& recv_counts,
+  const std::vector< int >& recv_displacements )
+{
+  MPI_Alltoallv( send_buffer,
+    &send_counts[ 0 ],
+    &send_displacements[ 0 ],
+    MPI_UNSIGNED,
+    recv_buffer,
+    &recv_counts[ 0 ],
+    &recv_displacements[ 0 ],
+    MPI_UNSIGNED,
+    comm );
+}
+
+void
+nest::MPIManager::communicate_Alltoall_counts( const std::vector< int >& send_counts, std::vector< int >& recv_counts )
+{
+  assert( send_counts.size() == static_cast< size_t >( get_num_processes() ) );
+  recv_counts.resize( get_num_processes() );
+  MPI_Alltoall(
+    const_cast< int* >( &send_counts[ 0 ] ), 1, MPI_Type< int >::type, &recv_counts[ 0 ], 1, MPI_Type< int >::type, comm );
+}
+
+void
+nest::MPIManager::wait_spike_data_Ialltoall()
+{
+  // returns immediately if the request is MPI_REQUEST_NULL
+  MPI_Wait( &spike_data_request_, MPI_STATUS_IGNORE );
+}
 
 void
 nest::MPIManager::communicate_secondary_events_Alltoall_( void* send_buffer, void* recv_buffer )
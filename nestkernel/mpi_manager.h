@@ -203,6 +203,15 @@ public:
 #ifdef HAVE_MPI
   void communicate_Alltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
 
+  void communicate_Ialltoall_( void* send_buffer, void* recv_buffer, const unsigned int send_recv_count );
+
+  void communicate_Alltoallv_( void* send_buffer,
+    const std::vector< int >& send_counts,
+    const std::vector< int >& send_displacements,
+    void* recv_buffer,
+    const std::vector< int >& recv_counts,
+    const std::vector< int >& recv_displacements );
+
   void communicate_secondary_events_Alltoall_( void* send_buffer, void* recv_buffer );
 #endif // HAVE_MPI
 
@@ -219,6 +228,36 @@ public:
   template < class D >
   void communicate_secondary_events_Alltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
 
+  /**
+   * Sends send_counts[ rank ] to each rank and stores the number
+   * received from each rank in recv_counts.
+   */
+  void communicate_Alltoall_counts( const std::vector< int >& send_counts, std::vector< int >& recv_counts );
+
+  /**
+   * Exchanges a variable number of entries with each rank. Counts are
+   * given in entries of type D; the entries for each rank are stored
+   * contiguously in order of ranks in both buffers.
+   */
+  template < class D >
+  void communicate_Alltoallv( std::vector< D >& send_buffer,
+    const std::vector< int >& send_counts,
+    std::vector< D >& recv_buffer,
+    const std::vector< int >& recv_counts );
+
+  /**
+   * Starts a non-blocking exchange of spike data. Neither buffer may be
+   * accessed before wait_spike_data_Ialltoall() has returned.
+   */
+  template < class D >
+  void communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer );
+
+  /**
+   * Waits for completion of the exchange started by
+   * communicate_spike_data_Ialltoall().
+   */
+  void wait_spike_data_Ialltoall();
+
   void synchronize();
 
   // TODO: not used...
@@ -308,6 +347,9 @@ private:
   std::vector< int > comm_step_;
   unsigned int COMM_OVERFLOW_ERROR;
 
+  //! handle of pending non-blocking spike exchange
+  MPI_Request spike_data_request_;
+
 //! Variable to hold the MPI communicator to use (the datatype matters).
 #ifdef HAVE_MUSIC
   MPI::Intracomm comm;
@@ -654,6 +696,17 @@ MPIManager::synchronize()
 {
 }
 
+inline void
+MPIManager::wait_spike_data_Ialltoall()
+{
+}
+
+inline void
+MPIManager::communicate_Alltoall_counts( const std::vector< int >& send_counts, std::vector< int >& recv_counts )
+{
+  recv_counts = send_counts;
+}
+
 inline void
 test_link( int, int )
 {
@@ -735,6 +788,55 @@ MPIManager::communicate_secondary_events_Alltoall( std::vector< D >& send_buffer
   communicate_secondary_events_Alltoall_( send_buffer_int, recv_buffer_int );
 }
 
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  const size_t send_recv_count_spike_data_in_int_per_rank =
+    sizeof( SpikeData ) / sizeof( unsigned int ) * send_recv_count_spike_data_per_rank_;
+
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Ialltoall_( send_buffer_int, recv_buffer_int, send_recv_count_spike_data_in_int_per_rank );
+}
+
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  const std::vector< int >& send_counts,
+  std::vector< D >& recv_buffer,
+  const std::vector< int >& recv_counts )
+{
+  // counts and displacements are communicated in units of unsigned int
+  const int int_per_entry = sizeof( D ) / sizeof( unsigned int );
+
+  std::vector< int > send_counts_int( get_num_processes() );
+  std::vector< int > send_displacements_int( get_num_processes(), 0 );
+  std::vector< int > recv_counts_int( get_num_processes() );
+  std::vector< int > recv_displacements_int( get_num_processes(), 0 );
+  for ( int rank = 0; rank < get_num_processes(); ++rank )
+  {
+    send_counts_int[ rank ] = int_per_entry * send_counts[ rank ];
+    recv_counts_int[ rank ] = int_per_entry * recv_counts[ rank ];
+    if ( rank > 0 )
+    {
+      send_displacements_int[ rank ] = send_displacements_int[ rank - 1 ] + send_counts_int[ rank - 1 ];
+      recv_displacements_int[ rank ] = recv_displacements_int[ rank - 1 ] + recv_counts_int[ rank - 1 ];
+    }
+  }
+
+  void* send_buffer_int = static_cast< void* >( &send_buffer[ 0 ] );
+  void* recv_buffer_int = static_cast< void* >( &recv_buffer[ 0 ] );
+
+  communicate_Alltoallv_( send_buffer_int,
+    send_counts_int,
+    send_displacements_int,
+    recv_buffer_int,
+    recv_counts_int,
+    recv_displacements_int );
+}
+
 
 #else // HAVE_MPI
 template < class D >
@@ -753,6 +855,23 @@ MPIManager::communicate_secondary_events_Alltoall( std::vector< D >& send_buffer
   recv_buffer.swap( send_buffer );
 }
 
+template < class D >
+void
+MPIManager::communicate_spike_data_Ialltoall( std::vector< D >& send_buffer, std::vector< D >& recv_buffer )
+{
+  recv_buffer.swap( send_buffer );
+}
+
+template < class D >
+void
+MPIManager::communicate_Alltoallv( std::vector< D >& send_buffer,
+  const std::vector< int >&,
+  std::vector< D >& recv_buffer,
+  const std::vector< int >& )
+{
+  recv_buffer.swap( send_buffer );
+}
+
 #endif // HAVE_MPI
 
 template < class D >
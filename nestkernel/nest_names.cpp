@@ -63,6 +63,8 @@ const Name autapses( "autapses" );
 const Name available( "available" );
 
 const Name b( "b" );
+const Name balanced_imbalance( "balanced_imbalance" );
+const Name batch_spike_delivery( "batch_spike_delivery" );
 const Name beta( "beta" );
 const Name beta_Ca( "beta_Ca" );
 const Name binary( "binary" );
@@ -152,6 +154,7 @@ const Name eta( "eta" );
 const Name events( "events" );
 const Name ex_spikes( "ex_spikes" );
 
+const Name fast_forward_quiescent( "fast_forward_quiescent" );
 const Name fbuffer_size( "fbuffer_size" );
 const Name file( "file" );
 const Name file_extension( "file_extension" );
@@ -220,6 +223,7 @@ const Name I_syn( "I_syn" );
 const Name I_syn_ex( "I_syn_ex" );
 const Name I_syn_in( "I_syn_in" );
 const Name I_T( "I_T" );
+const Name imbalance( "imbalance" );
 const Name in_spikes( "in_spikes" );
 const Name Inact_h( "Inact_h" );
 const Name Inact_p( "Inact_p" );
@@ -252,15 +256,18 @@ const Name lookuptable_1( "lookuptable_1" );
 const Name lookuptable_2( "lookuptable_2" );
 
 const Name make_symmetric( "make_symmetric" );
+const Name max( "max" );
 const Name max_buffer_size_spike_data( "max_buffer_size_spike_data" );
 const Name max_buffer_size_target_data( "max_buffer_size_target_data" );
 const Name max_num_syn_models( "max_num_syn_models" );
 const Name max_delay( "max_delay" );
 const Name MAXERR( "MAXERR" );
 const Name mean( "mean" );
+const Name measure_update_cost( "measure_update_cost" );
 const Name memory( "memory" );
 const Name message_times( "messages_times" );
 const Name messages( "messages" );
+const Name min( "min" );
 const Name min_delay( "min_delay" );
 const Name model( "model" );
 const Name mother_rng( "mother_rng" );
@@ -308,7 +315,11 @@ const Name P( "P" );
 const Name p_copy( "p_copy" );
 const Name p_transmit( "p_transmit" );
 const Name parent( "parent" );
+const Name per_rank( "per_rank" );
+const Name per_thread( "per_thread" );
 const Name phase( "phase" );
+const Name pipelined_spike_exchange( "pipelined_spike_exchange" );
+const Name population_update( "population_update" );
 const Name port( "port" );
 const Name port_name( "port_name" );
 const Name port_width( "port_width" );
@@ -369,6 +380,9 @@ const Name soma_curr( "soma_curr" );
 const Name soma_exc( "soma_exc" );
 const Name soma_inh( "soma_inh" );
 const Name sort_connections_by_source( "sort_connections_by_source" );
+const Name sort_spike_delivery( "sort_spike_delivery" );
+const Name sparse_spike_exchange( "sparse_spike_exchange" );
+const Name sparse_target_data_exchange( "sparse_target_data_exchange" );
 const Name source( "source" );
 const Name spike( "spike" );
 const Name spike_multiplicities( "spike_multiplicities" );
@@ -402,6 +416,7 @@ const Name t_ref_remaining( "t_ref_remaining" );
 const Name t_ref_tot( "t_ref_tot" );
 const Name t_spike( "t_spike" );
 const Name target( "target" );
+const Name target_data_chunk_size( "target_data_chunk_size" );
 const Name target_thread( "target_thread" );
 const Name targets( "targets" );
 const Name tau( "tau" );
@@ -469,8 +484,18 @@ const Name tics_per_ms( "tics_per_ms" );
 const Name tics_per_step( "tics_per_step" );
 const Name time( "time" );
 const Name time_collocate( "time_collocate" );
+const Name time_collocate_spike_data( "time_collocate_spike_data" );
 const Name time_communicate( "time_communicate" );
+const Name time_communicate_spike_data( "time_communicate_spike_data" );
+const Name time_deliver_spike_data( "time_deliver_spike_data" );
+const Name time_gather_target_data( "time_gather_target_data" );
 const Name time_in_steps( "time_in_steps" );
+const Name time_omp_synchronization( "time_omp_synchronization" );
+const Name time_prepare_connection_infrastructure( "time_prepare_connection_infrastructure" );
+const Name time_secondary_events( "time_secondary_events" );
+const Name time_sort_connections( "time_sort_connections" );
+const Name time_update( "time_update" );
+const Name time_wfr( "time_wfr" );
 const Name times( "times" );
 const Name to_accumulator( "to_accumulator" );
 const Name to_do( "to_do" );
@@ -478,6 +503,9 @@ const Name to_file( "to_file" );
 const Name to_memory( "to_memory" );
 const Name to_screen( "to_screen" );
 const Name total_num_virtual_procs( "total_num_virtual_procs" );
+const Name trace_buffer_dropped( "trace_buffer_dropped" );
+const Name trace_buffer_memory( "trace_buffer_memory" );
+const Name trace_buffer_size( "trace_buffer_size" );
 const Name Tstart( "Tstart" );
 const Name Tstop( "Tstop" );
 const Name type_id( "type_id" );
@@ -490,7 +518,9 @@ const Name U( "U" );
 const Name U_m( "U_m" );
 const Name u_ref_squared( "u_ref_squared" );
 const Name update( "update" );
+const Name update_cost( "update_cost" );
 const Name update_node( "update_node" );
+const Name use_compressed_spikes( "use_compressed_spikes" );
 const Name use_gid_in_filename( "use_gid_in_filename" );
 const Name use_wfr( "use_wfr" );
 
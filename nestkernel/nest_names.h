@@ -84,6 +84,8 @@ extern const Name autapses;
 extern const Name available;
 
 extern const Name b;
+extern const Name balanced_imbalance;
+extern const Name batch_spike_delivery;
 extern const Name beta;
 extern const Name beta_Ca;
 extern const Name binary;
@@ -173,6 +175,7 @@ extern const Name eta;
 extern const Name events;
 extern const Name ex_spikes;
 
+extern const Name fast_forward_quiescent;
 extern const Name fbuffer_size;
 extern const Name file;
 extern const Name file_extension;
@@ -241,6 +244,7 @@ extern const Name I_syn;
 extern const Name I_syn_ex;
 extern const Name I_syn_in;
 extern const Name I_T;
+extern const Name imbalance;
 extern const Name in_spikes;
 extern const Name Inact_h;
 extern const Name Inact_p;
@@ -273,15 +277,18 @@ extern const Name lookuptable_1;
 extern const Name lookuptable_2;
 
 extern const Name make_symmetric;
+extern const Name max;
 extern const Name max_buffer_size_spike_data;
 extern const Name max_buffer_size_target_data;
 extern const Name max_num_syn_models;
 extern const Name max_delay;
 extern const Name MAXERR;
 extern const Name mean;
+extern const Name measure_update_cost;
 extern const Name memory;
 extern const Name message_times;
 extern const Name messages;
+extern const Name min;
 extern const Name min_delay;
 extern const Name model;
 extern const Name mother_rng;
@@ -329,7 +336,11 @@ extern const Name P;
 extern const Name p_copy;
 extern const Name p_transmit;
 extern const Name parent;
+extern const Name per_rank;
+extern const Name per_thread;
 extern const Name phase;
+extern const Name pipelined_spike_exchange;
+extern const Name population_update;
 extern const Name port;
 extern const Name port_name;
 extern const Name port_width;
@@ -390,6 +401,9 @@ extern const Name soma_curr;
 extern const Name soma_exc;
 extern const Name soma_inh;
 extern const Name sort_connections_by_source;
+extern const Name sort_spike_delivery;
+extern const Name sparse_spike_exchange;
+extern const Name sparse_target_data_exchange;
 extern const Name source;
 extern const Name spike;
 extern const Name spike_multiplicities;
@@ -423,6 +437,7 @@ extern const Name t_ref_remaining;
 extern const Name t_ref_tot;
 extern const Name t_spike;
 extern const Name target;
+extern const Name target_data_chunk_size;
 extern const Name target_thread;
 extern const Name targets;
 extern const Name tau;
@@ -490,8 +505,18 @@ extern const Name tics_per_ms;
 extern const Name tics_per_step;
 extern const Name time;
 extern const Name time_collocate;
+extern const Name time_collocate_spike_data;
 extern const Name time_communicate;
+extern const Name time_communicate_spike_data;
+extern const Name time_deliver_spike_data;
+extern const Name time_gather_target_data;
 extern const Name time_in_steps;
+extern const Name time_omp_synchronization;
+extern const Name time_prepare_connection_infrastructure;
+extern const Name time_secondary_events;
+extern const Name time_sort_connections;
+extern const Name time_update;
+extern const Name time_wfr;
 extern const Name times;
 extern const Name to_accumulator;
 extern const Name to_do;
@@ -499,6 +524,9 @@ extern const Name to_file;
 extern const Name to_memory;
 extern const Name to_screen;
 extern const Name total_num_virtual_procs;
+extern const Name trace_buffer_dropped;
+extern const Name trace_buffer_memory;
+extern const Name trace_buffer_size;
 extern const Name Tstart;
 extern const Name Tstop;
 extern const Name type_id;
@@ -511,7 +539,9 @@ extern const Name u_bar_minus;
 extern const Name U_m;
 extern const Name u_ref_squared;
 extern const Name update;
+extern const Name update_cost;
 extern const Name update_node;
+extern const Name use_compressed_spikes;
 extern const Name use_gid_in_filename;
 extern const Name use_wfr;
 
@@ -230,6 +230,16 @@ Node::register_stdp_connection( double, double )
   throw IllegalConnection();
 }
 
+/**
+ * Default implementation of register_trace_connection() just
+ * throws IllegalConnection
+ */
+void
+Node::register_trace_connection()
+{
+  throw IllegalConnection();
+}
+
 /**
  * Default implementation of event handlers just throws
  * an UnexpectedEvent exception.
@@ -455,6 +465,18 @@ nest::Node::get_LTP_history( double,
   throw UnexpectedEvent();
 }
 
+const TraceBuffer&
+Node::get_trace_buffer() const
+{
+  throw UnexpectedEvent();
+}
+
+double
+Node::get_trace_K_value( double )
+{
+  throw UnexpectedEvent();
+}
+
 void
 Node::event_hook( DSSpikeEvent& e )
 {
@@ -34,6 +34,7 @@
 // Includes from nestkernel:
 #include "event.h"
 #include "histentry.h"
+#include "trace_buffer.h"
 #include "nest_names.h"
 #include "nest_time.h"
 #include "nest_types.h"
@@ -474,6 +475,14 @@ public:
    */
   virtual void register_stdp_connection( double, double );
 
+  /**
+   * Register a STDP connection that reads the trace buffer
+   *
+   * @throws IllegalConnection
+   *
+   */
+  virtual void register_trace_connection();
+
   /**
    * Handle incoming spike events.
    * @param thrd Id of the calling thread.
@@ -697,6 +706,18 @@ public:
     std::deque< histentry_cl >::iterator* start,
     std::deque< histentry_cl >::iterator* finish );
 
+  /**
+   * return the buffer of the most recent spikes and Kminus values.
+   * @throws UnexpectedEvent
+   */
+  virtual const TraceBuffer& get_trace_buffer() const;
+
+  /**
+   * return the Kminus value at t (in ms) from the trace buffer.
+   * @throws UnexpectedEvent
+   */
+  virtual double get_trace_K_value( double t );
+
   /**
    * Modify Event object parameters during event delivery.
    * Some Nodes want to perform a function on an event for each
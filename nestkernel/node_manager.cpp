@@ -57,6 +57,9 @@ NodeManager::NodeManager()
   , wfr_is_used_( false )
   , nodes_vec_network_size_( 0 ) // zero to force update
   , have_nodes_changed_( true )
+  , population_update_( false )
+  , fast_forward_quiescent_( false )
+  , population_engines_()
 {
 }
 
@@ -122,6 +125,8 @@ NodeManager::initialize()
   ensure_valid_thread_local_ids();
 
   num_local_devices_ = 0;
+  population_update_ = false;
+  fast_forward_quiescent_ = false;
 }
 
 void
@@ -133,6 +138,9 @@ NodeManager::finalize()
 void
 NodeManager::reinit_nodes()
 {
+  // the state is reset in the neurons themselves
+  clear_population_engines();
+
   /* Reinitialize state on all nodes, force init_buffers() on next
       call to simulate().
       Finding all nodes is non-trivial:
@@ -231,7 +239,10 @@ index NodeManager::add_node( index mod, long n ) // no_p
 
   if ( model->has_proxies() )
   {
-    // In this branch we create nodes for all GIDs which are on a local thread
+    // In this branch we create nodes for all GIDs which are on a local thread.
+    // Each thread reserves the memory for its own nodes and constructs them,
+    // so that the memory is first touched by, and thus placed close to, the
+    // thread that later updates the nodes.
     const int n_per_process = n / kernel().mpi_manager.get_num_processes();
     const int n_per_thread = n_per_process / n_threads + 1;
 
@@ -241,11 +252,54 @@ index NodeManager::add_node( index mod, long n ) // no_p
     //       are for subnets and devices.
     local_nodes_.reserve(
       std::ceil( static_cast< double >( max_gid ) / kernel().mpi_manager.get_num_processes() ) + 50 );
-    for ( thread tid = 0; tid < n_threads; ++tid )
+
+    std::vector< std::vector< Node* > > new_nodes( n_threads );
+    std::vector< lockPTR< WrappedThreadException > > exceptions_raised( n_threads );
+
+#ifdef _OPENMP
+#pragma omp parallel
+    {
+      const thread t = kernel().vp_manager.get_thread_id();
+#else
+    for ( thread t = 0; t < n_threads; ++t )
+    {
+#endif
+      // We create nodes in a parallel region. Therefore, we need to catch
+      // exceptions here and then handle them after the parallel region.
+      try
+      {
+        // Model::reserve() reserves memory for n ADDITIONAL nodes on thread t
+        // reserves at least one entry on each thread, nobody knows why
+        model->reserve_additional( t, n_per_thread );
+        new_nodes[ t ].reserve( n_per_thread );
+
+        // GIDs are distributed round-robin across virtual processes
+        const thread vp = kernel().vp_manager.thread_to_vp( t );
+        const index num_vps = kernel().vp_manager.get_num_virtual_processes();
+        for ( index gid = min_gid + ( vp + num_vps - min_gid % num_vps ) % num_vps; gid < max_gid; gid += num_vps )
+        {
+          Node* newnode = model->allocate( t );
+          newnode->set_gid_( gid );
+          newnode->set_model_id( mod );
+          newnode->set_thread( t );
+          newnode->set_vp( vp );
+          new_nodes[ t ].push_back( newnode );
+        }
+      }
+      catch ( std::exception& e )
+      {
+        // so throw the exception after parallel region
+        exceptions_raised.at( t ) = lockPTR< WrappedThreadException >( new WrappedThreadException( e ) );
+      }
+    } // end of parallel section / end of for threads
+
+    // check if any exceptions have been raised
+    for ( thread t = 0; t < n_threads; ++t )
     {
-      // Model::reserve() reserves memory for n ADDITIONAL nodes on thread t
-      // reserves at least one entry on each thread, nobody knows why
-      model->reserve_additional( tid, n_per_thread );
+      if ( exceptions_raised.at( t ).valid() )
+      {
+        throw WrappedThreadException( *( exceptions_raised.at( t ) ) );
+      }
     }
 
     size_t gid;
@@ -266,6 +320,10 @@ index NodeManager::add_node( index mod, long n ) // no_p
     // become irrelevant.
     current_->add_gid_range( min_gid, max_gid - 1 );
 
+    // The new nodes are registered in the order of their GIDs, which
+    // alternates between the threads.
+    std::vector< size_t > num_registered( n_threads, 0 );
+
     // min_gid is first valid gid i should create, hence ask for the first local
     // gid after min_gid-1
     while ( gid < max_gid )
@@ -275,11 +333,8 @@ index NodeManager::add_node( index mod, long n ) // no_p
 
       if ( kernel().vp_manager.is_local_vp( vp ) )
       {
-        Node* newnode = model->allocate( t );
-        newnode->set_gid_( gid );
-        newnode->set_model_id( mod );
-        newnode->set_thread( t );
-        newnode->set_vp( vp );
+        Node* newnode = new_nodes[ t ][ num_registered[ t ]++ ];
+        assert( newnode->get_gid() == gid );
 
         local_nodes_.add_local_node( *newnode ); // put into local nodes list
         current_->add_node( newnode );           // and into current subnet, thread 0.
@@ -679,6 +734,8 @@ NodeManager::ensure_valid_thread_local_ids()
 void
 NodeManager::destruct_nodes_()
 {
+  clear_population_engines();
+
   // We call the destructor for each node excplicitly. This destroys
   // the objects without releasing their memory. Since the Memory is
   // owned by the Model objects, we must not call delete on the Node
@@ -697,6 +754,22 @@ NodeManager::destruct_nodes_()
   local_nodes_.clear();
 }
 
+void
+NodeManager::clear_population_engines()
+{
+  for ( size_t t = 0; t < population_engines_.size(); ++t )
+  {
+    for ( std::vector< PopulationEngine* >::iterator it = population_engines_[ t ].begin();
+          it != population_engines_[ t ].end();
+          ++it )
+    {
+      ( *it )->detach();
+      delete *it;
+    }
+  }
+  population_engines_.clear();
+}
+
 void
 NodeManager::set_status_single_node_( Node& target, const DictionaryDatum& d, bool clear_flags )
 {
@@ -731,6 +804,10 @@ NodeManager::prepare_nodes()
 
   /* We initialize the buffers of each node and calibrate it. */
 
+  // neurons attach to new engines when they are calibrated
+  clear_population_engines();
+  population_engines_.resize( kernel().vp_manager.get_num_threads() );
+
   size_t num_active_nodes = 0;     // counts nodes that will be updated
   size_t num_active_wfr_nodes = 0; // counts nodes that use waveform relaxation
 
@@ -859,6 +936,9 @@ NodeManager::finalize_nodes()
       }
     }
   }
+
+  // neurons hold their own state between simulations
+  clear_population_engines();
 }
 
 void
@@ -923,6 +1003,8 @@ void
 NodeManager::get_status( DictionaryDatum& d )
 {
   def< long >( d, names::network_size, size() );
+  def< bool >( d, names::population_update, population_update_ );
+  def< bool >( d, names::fast_forward_quiescent, fast_forward_quiescent_ );
 
   std::map< long, size_t > sna_cts = local_nodes_.get_step_ctr();
   DictionaryDatum cdict( new Dictionary );
@@ -937,6 +1019,9 @@ NodeManager::get_status( DictionaryDatum& d )
 void
 NodeManager::set_status( const DictionaryDatum& d )
 {
+  updateValue< bool >( d, names::population_update, population_update_ );
+  updateValue< bool >( d, names::fast_forward_quiescent, fast_forward_quiescent_ );
+
   std::string tmp;
   // proceed only if there are unaccessed items left
   if ( not d->all_accessed( tmp ) )
@@ -961,6 +1046,9 @@ NodeManager::set_status( const DictionaryDatum& d )
 void
 NodeManager::reset_nodes_state()
 {
+  // the state is reset in the neurons themselves
+  clear_population_engines();
+
   /* Reinitialize state on all nodes, force init_buffers() on next
      call to simulate().
      Finding all nodes is non-trivial:
@@ -24,6 +24,7 @@
 #define NODE_MANAGER_H
 
 // C++ includes:
+#include <cassert>
 #include <vector>
 
 // Includes from libnestutil:
@@ -32,6 +33,7 @@
 // Includes from nestkernel:
 #include "conn_builder.h"
 #include "nest_types.h"
+#include "population_engine.h"
 #include "sparse_node_array.h"
 
 // Includes from sli:
@@ -229,6 +231,38 @@ public:
    */
   void check_wfr_use();
 
+  /**
+   * Returns whether neurons are attached to population engines when
+   * they are calibrated.
+   * @see PopulationEngine
+   */
+  bool use_population_update() const;
+
+  /**
+   * Returns whether neurons that support it advance over steps without
+   * input in closed form.
+   */
+  bool use_fast_forward() const;
+
+  /**
+   * Returns the population engine of type EngineT on thread tid and
+   * creates it if it does not exist yet. Must only be called by thread
+   * tid while preparing the nodes.
+   */
+  template < typename EngineT >
+  EngineT& get_population_engine( const thread tid );
+
+  /**
+   * Updates all population engines on thread tid.
+   */
+  void update_population_engines( const thread tid, Time const& origin, const long from, const long to );
+
+  /**
+   * Detaches all neurons from the population engines and deletes the
+   * engines. Must be called outside of parallel regions.
+   */
+  void clear_population_engines();
+
   /**
    * Iterator pointing to beginning of process-local nodes.
    */
@@ -309,6 +343,15 @@ private:
 
   bool have_nodes_changed_; //!< true if new nodes have been created
                             //!< since startup or last call to simulate
+
+  //! whether neurons are updated by population engines if they support it
+  bool population_update_;
+
+  //! whether quiescent neurons skip steps without input if they support it
+  bool fast_forward_quiescent_;
+
+  //! Population engines created by prepare_nodes(), per thread
+  std::vector< std::vector< PopulationEngine* > > population_engines_;
 };
 
 inline index
@@ -359,6 +402,48 @@ NodeManager::wfr_is_used() const
   return wfr_is_used_;
 }
 
+inline bool
+NodeManager::use_population_update() const
+{
+  return population_update_;
+}
+
+inline bool
+NodeManager::use_fast_forward() const
+{
+  return fast_forward_quiescent_;
+}
+
+template < typename EngineT >
+EngineT&
+NodeManager::get_population_engine( const thread tid )
+{
+  assert( static_cast< size_t >( tid ) < population_engines_.size() );
+  std::vector< PopulationEngine* >& engines = population_engines_[ tid ];
+  for ( std::vector< PopulationEngine* >::iterator it = engines.begin(); it != engines.end(); ++it )
+  {
+    EngineT* engine = dynamic_cast< EngineT* >( *it );
+    if ( engine != 0 )
+    {
+      return *engine;
+    }
+  }
+
+  EngineT* engine = new EngineT();
+  engines.push_back( engine );
+  return *engine;
+}
+
+inline void
+NodeManager::update_population_engines( const thread tid, Time const& origin, const long from, const long to )
+{
+  std::vector< PopulationEngine* >& engines = population_engines_[ tid ];
+  for ( std::vector< PopulationEngine* >::iterator it = engines.begin(); it != engines.end(); ++it )
+  {
+    ( *it )->update( origin, from, to );
+  }
+}
+
 inline SparseNodeArray::const_iterator
 NodeManager::local_nodes_begin() const
 {
@@ -0,0 +1,133 @@
+/*
+ *  phase_timer.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "phase_timer.h"
+
+// C++ includes:
+#include <algorithm>
+#include <numeric>
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "nest_names.h"
+#include "vp_manager.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "dictutils.h"
+#include "doubledatum.h"
+
+namespace nest
+{
+
+PhaseTimer::PhaseTimer()
+  : stopwatches_()
+  , global_times_()
+  , displacements_()
+{
+}
+
+void
+PhaseTimer::reset( const thread num_threads )
+{
+  VPManager::assert_single_threaded();
+  stopwatches_.assign( num_threads, Stopwatch() );
+  global_times_.clear();
+  displacements_.clear();
+}
+
+double
+PhaseTimer::get_local_mean() const
+{
+  if ( stopwatches_.empty() )
+  {
+    return 0.0;
+  }
+
+  double sum = 0.0;
+  for ( size_t tid = 0; tid < stopwatches_.size(); ++tid )
+  {
+    sum += stopwatches_[ tid ].elapsed();
+  }
+  return sum / stopwatches_.size();
+}
+
+void
+PhaseTimer::gather()
+{
+  VPManager::assert_single_threaded();
+
+  std::vector< double > local_times( stopwatches_.size() );
+  for ( size_t tid = 0; tid < stopwatches_.size(); ++tid )
+  {
+    local_times[ tid ] = stopwatches_[ tid ].elapsed();
+  }
+
+  kernel().mpi_manager.communicate( local_times, global_times_, displacements_ );
+}
+
+void
+PhaseTimer::get_status( DictionaryDatum& d, const Name& name ) const
+{
+  DictionaryDatum timer( new Dictionary );
+
+  std::vector< double > per_thread( stopwatches_.size() );
+  for ( size_t tid = 0; tid < stopwatches_.size(); ++tid )
+  {
+    per_thread[ tid ] = stopwatches_[ tid ].elapsed();
+  }
+  ( *timer )[ names::per_thread ] = DoubleVectorDatum( new std::vector< double >( per_thread ) );
+
+  // before the first run or if the run was interrupted, only the local
+  // times are known
+  const std::vector< double >& all_times = global_times_.empty() ? per_thread : global_times_;
+  const size_t num_ranks = global_times_.empty() ? 1 : displacements_.size();
+
+  std::vector< double > per_rank( num_ranks, 0.0 );
+  for ( size_t rank = 0; rank < num_ranks; ++rank )
+  {
+    const size_t begin = global_times_.empty() ? 0 : displacements_[ rank ];
+    const size_t end = rank + 1 < num_ranks ? displacements_[ rank + 1 ] : all_times.size();
+    if ( end > begin )
+    {
+      per_rank[ rank ] = std::accumulate( all_times.begin() + begin, all_times.begin() + end, 0.0 ) / ( end - begin );
+    }
+  }
+  ( *timer )[ names::per_rank ] = DoubleVectorDatum( new std::vector< double >( per_rank ) );
+
+  double min = 0.0;
+  double max = 0.0;
+  double mean = 0.0;
+  if ( not all_times.empty() )
+  {
+    min = *std::min_element( all_times.begin(), all_times.end() );
+    max = *std::max_element( all_times.begin(), all_times.end() );
+    mean = std::accumulate( all_times.begin(), all_times.end(), 0.0 ) / all_times.size();
+  }
+  def< double >( timer, names::min, min );
+  def< double >( timer, names::max, max );
+  def< double >( timer, names::mean, mean );
+
+  ( *d )[ name ] = timer;
+}
+
+} // namespace nest
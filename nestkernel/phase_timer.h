@@ -0,0 +1,144 @@
+/*
+ *  phase_timer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef PHASE_TIMER_H
+#define PHASE_TIMER_H
+
+// C++ includes:
+#include <cassert>
+#include <vector>
+
+// Includes from libnestutil:
+#include "stopwatch.h"
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+#include "name.h"
+
+namespace nest
+{
+
+/**
+ * Measures the wall-clock time that each thread spends in one phase of
+ * the simulation loop, e.g., the update of nodes or the communication
+ * of spikes.
+ *
+ * Every thread only touches its own stopwatch, such that start() and
+ * stop() can be called inside parallel regions without
+ * synchronization. After a run, gather() collects the times of all
+ * threads on all MPI processes, which are then reported by get_status()
+ * together with their minimum, maximum and mean.
+ */
+class PhaseTimer
+{
+public:
+  PhaseTimer();
+
+  /**
+   * Sets up one stopped stopwatch per thread and discards all
+   * measurements. Must be called outside of parallel regions.
+   */
+  void reset( const thread num_threads );
+
+  /**
+   * Starts or resumes the stopwatch of thread tid.
+   */
+  void start( const thread tid );
+
+  /**
+   * Stops the stopwatch of thread tid.
+   */
+  void stop( const thread tid );
+
+  /**
+   * Returns the time in seconds measured on thread tid.
+   */
+  double elapsed( const thread tid ) const;
+
+  /**
+   * Returns the number of threads the timer was reset for.
+   */
+  thread get_num_threads() const;
+
+  /**
+   * Returns the mean time in seconds measured by the threads of this
+   * MPI process.
+   */
+  double get_local_mean() const;
+
+  /**
+   * Collects the times of all threads across MPI processes. Must be
+   * called by all MPI processes outside of parallel regions.
+   */
+  void gather();
+
+  /**
+   * Writes a dictionary with the times of the local threads
+   * (per_thread), the mean time of each MPI process (per_rank) and the
+   * minimum, maximum and mean across all threads of all MPI processes
+   * to d under the given name.
+   */
+  void get_status( DictionaryDatum& d, const Name& name ) const;
+
+private:
+  //! One stopwatch per thread
+  std::vector< Stopwatch > stopwatches_;
+
+  //! Times of all threads of all MPI processes, ordered by rank
+  std::vector< double > global_times_;
+
+  //! Position of the first thread of each MPI process in global_times_
+  std::vector< int > displacements_;
+};
+
+inline void
+PhaseTimer::start( const thread tid )
+{
+  assert( static_cast< size_t >( tid ) < stopwatches_.size() );
+  stopwatches_[ tid ].start();
+}
+
+inline void
+PhaseTimer::stop( const thread tid )
+{
+  assert( static_cast< size_t >( tid ) < stopwatches_.size() );
+  stopwatches_[ tid ].stop();
+}
+
+inline double
+PhaseTimer::elapsed( const thread tid ) const
+{
+  return stopwatches_[ tid ].elapsed();
+}
+
+inline thread
+PhaseTimer::get_num_threads() const
+{
+  return stopwatches_.size();
+}
+
+} // namespace nest
+
+#endif /* PHASE_TIMER_H */
@@ -0,0 +1,74 @@
+/*
+ *  population_engine.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef POPULATION_ENGINE_H
+#define POPULATION_ENGINE_H
+
+// Includes from nestkernel:
+#include "nest_time.h"
+
+namespace nest
+{
+
+/**
+ * Base class for engines that update all neurons of one model on one
+ * thread together.
+ *
+ * If the kernel property population_update is set, models that provide
+ * a population engine attach their neurons to the engine of their
+ * thread in calibrate(). The engine holds the state of all attached
+ * neurons in one array per state variable and advances them in loops
+ * over neurons that the compiler can vectorize. The attached neurons
+ * remain ordinary nodes: they receive events into their own buffers,
+ * their update() returns immediately, and they read their state from
+ * the engine in get_status() and set_status().
+ *
+ * Engines are created and owned by the NodeManager. They are updated
+ * by SimulationManager::update_() before the nodes of the thread and
+ * deleted by NodeManager::clear_population_engines(), which first
+ * calls detach() to write the state back to the neurons. As engines
+ * are updated first, local devices such as spike detectors receive
+ * spikes of attached neurons as if the neurons had been created before
+ * the devices.
+ */
+class PopulationEngine
+{
+public:
+  virtual ~PopulationEngine()
+  {
+  }
+
+  /**
+   * Advance all attached neurons from step from to step to relative to
+   * origin, emitting spikes and recording data as the neurons would.
+   */
+  virtual void update( Time const& origin, const long from, const long to ) = 0;
+
+  /**
+   * Write the state back to all attached neurons and detach them.
+   */
+  virtual void detach() = 0;
+};
+
+} // namespace nest
+
+#endif /* POPULATION_ENGINE_H */
@@ -24,6 +24,7 @@
 
 nest::RingBuffer::RingBuffer()
   : buffer_( kernel().connection_manager.get_min_delay() + kernel().connection_manager.get_max_delay(), 0.0 )
+  , num_pending_( 0 )
 {
 }
 
@@ -43,6 +44,7 @@ nest::RingBuffer::clear()
   resize(); // does nothing if size is fine
   // clear all elements
   buffer_.assign( buffer_.size(), 0.0 );
+  num_pending_ = 0;
 }
 
 
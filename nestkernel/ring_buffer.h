@@ -111,6 +111,13 @@ public:
    */
   double get_value_wfr_update( const long offs );
 
+  /**
+   * Returns the number of consecutive steps, beginning at offs and ending
+   * before offs_end at the latest, for which the buffer holds no input.
+   * Does not change the buffer.
+   */
+  long get_num_empty_steps( const long offs, const long offs_end ) const;
+
   /**
    * Initialize the buffer with noughts.
    * Also resizes the buffer if necessary.
@@ -137,6 +144,13 @@ private:
   //! Buffered data
   std::vector< double > buffer_;
 
+  /**
+   * Upper bound of the number of non-zero entries. Entries that become
+   * zero by adding values of opposite sign remain counted until the
+   * buffer is cleared.
+   */
+  size_t num_pending_;
+
   /**
    * Obtain buffer index.
    * @param delay delivery delay for event
@@ -149,13 +163,24 @@ private:
 inline void
 RingBuffer::add_value( const long offs, const double v )
 {
-  buffer_[ get_index_( offs ) ] += v;
+  double& entry = buffer_[ get_index_( offs ) ];
+  num_pending_ += ( entry == 0.0 and v != 0.0 );
+  entry += v;
 }
 
 inline void
 RingBuffer::set_value( const long offs, const double v )
 {
-  buffer_[ get_index_( offs ) ] = v;
+  double& entry = buffer_[ get_index_( offs ) ];
+  if ( entry == 0.0 and v != 0.0 )
+  {
+    ++num_pending_;
+  }
+  else if ( entry != 0.0 and v == 0.0 )
+  {
+    --num_pending_;
+  }
+  entry = v;
 }
 
 inline double
@@ -168,7 +193,11 @@ RingBuffer::get_value( const long offs )
   // take modulo into account when indexing
   long idx = get_index_( offs );
   double val = buffer_[ idx ];
-  buffer_[ idx ] = 0.0; // clear buffer after reading
+  if ( val != 0.0 )
+  {
+    buffer_[ idx ] = 0.0; // clear buffer after reading
+    --num_pending_;
+  }
   return val;
 }
 
@@ -185,6 +214,22 @@ RingBuffer::get_value_wfr_update( const long offs )
   return val;
 }
 
+inline long
+RingBuffer::get_num_empty_steps( const long offs, const long offs_end ) const
+{
+  if ( num_pending_ == 0 )
+  {
+    return offs_end - offs;
+  }
+
+  long n = offs;
+  while ( n < offs_end and buffer_[ get_index_( n ) ] == 0.0 )
+  {
+    ++n;
+  }
+  return n - offs;
+}
+
 inline size_t
 RingBuffer::get_index_( const delay d ) const
 {
@@ -50,9 +50,18 @@ private:
 
   const unsigned int max_size_;
 
+  //! total number of entries in the chunks of the assigned ranks
+  size_t num_spike_data_capacity_;
+
 public:
   SendBufferPosition( const AssignedRanks& assigned_ranks, const unsigned int send_recv_count_per_rank );
 
+  /**
+   * Creates positions for chunks of variable size, where the chunk of
+   * rank r begins at displacements[ r ] and ends at displacements[ r + 1 ].
+   */
+  SendBufferPosition( const AssignedRanks& assigned_ranks, const std::vector< unsigned int >& displacements );
+
   /**
    * Returns current index of specified rank in MPI buffer.
    */
@@ -91,6 +100,7 @@ inline SendBufferPosition::SendBufferPosition( const AssignedRanks& assigned_ran
   const unsigned int send_recv_count_per_rank )
   : num_spike_data_written_( 0 )
   , max_size_( assigned_ranks.max_size )
+  , num_spike_data_capacity_( send_recv_count_per_rank * assigned_ranks.size )
   , send_recv_count_per_rank( send_recv_count_per_rank )
 {
   idx_.resize( assigned_ranks.size );
@@ -107,6 +117,28 @@ inline SendBufferPosition::SendBufferPosition( const AssignedRanks& assigned_ran
   }
 }
 
+inline SendBufferPosition::SendBufferPosition( const AssignedRanks& assigned_ranks,
+  const std::vector< unsigned int >& displacements )
+  : num_spike_data_written_( 0 )
+  , max_size_( assigned_ranks.max_size )
+  , num_spike_data_capacity_( 0 )
+  , send_recv_count_per_rank( 0 )
+{
+  idx_.resize( assigned_ranks.size );
+  begin_.resize( assigned_ranks.size );
+  end_.resize( assigned_ranks.size );
+  for ( thread rank = assigned_ranks.begin; rank < assigned_ranks.end; ++rank )
+  {
+    // thread-local index of (global) rank
+    const thread lr_idx = rank % assigned_ranks.max_size;
+    assert( lr_idx < assigned_ranks.size );
+    idx_[ lr_idx ] = displacements[ rank ];
+    begin_[ lr_idx ] = displacements[ rank ];
+    end_[ lr_idx ] = displacements[ rank + 1 ];
+    num_spike_data_capacity_ += displacements[ rank + 1 ] - displacements[ rank ];
+  }
+}
+
 inline thread
 SendBufferPosition::rank_to_index_( const thread rank ) const
 {
@@ -140,7 +172,7 @@ SendBufferPosition::is_chunk_filled( const thread rank ) const
 inline bool
 SendBufferPosition::are_all_chunks_filled() const
 {
-  return num_spike_data_written_ == send_recv_count_per_rank * idx_.size();
+  return num_spike_data_written_ == num_spike_data_capacity_;
 }
 
 inline void
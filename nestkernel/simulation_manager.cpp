@@ -26,6 +26,7 @@
 #include <sys/time.h>
 
 // C++ includes:
+#include <algorithm>
 #include <vector>
 
 // Includes from libnestutil:
@@ -59,6 +60,15 @@ nest::SimulationManager::SimulationManager()
   , wfr_tol_( 0.0001 )
   , wfr_max_iterations_( 15 )
   , wfr_interpolation_order_( 3 )
+  , timer_update_()
+  , timer_wfr_()
+  , timer_secondary_events_()
+  , timer_omp_synchronization_()
+  , measure_update_cost_( false )
+  , update_cost_monitor_()
+  , timer_sort_connections_()
+  , timer_prepare_connection_infrastructure_()
+  , timer_gather_target_data_()
 {
 }
 
@@ -74,6 +84,11 @@ nest::SimulationManager::initialize()
   simulated_ = false;
   exit_on_user_signal_ = false;
   inconsistent_state_ = false;
+  reset_timers_();
+  reset_connection_infrastructure_timers();
+
+  measure_update_cost_ = false;
+  update_cost_monitor_.reset( kernel().vp_manager.get_num_threads() );
 }
 
 void
@@ -341,6 +356,17 @@ nest::SimulationManager::set_status( const DictionaryDatum& d )
     }
   }
 
+  // discard earlier measurements when the measurement is switched on
+  bool measure_update_cost;
+  if ( updateValue< bool >( d, names::measure_update_cost, measure_update_cost ) )
+  {
+    if ( measure_update_cost and not measure_update_cost_ )
+    {
+      update_cost_monitor_.reset( kernel().vp_manager.get_num_threads() );
+    }
+    measure_update_cost_ = measure_update_cost;
+  }
+
   // set the interpolation order for the waveform relaxation method
   long interp_order;
   if ( updateValue< long >( d, names::wfr_interpolation_order, interp_order ) )
@@ -376,6 +402,16 @@ nest::SimulationManager::get_status( DictionaryDatum& d )
   def< double >( d, names::wfr_tol, wfr_tol_ );
   def< long >( d, names::wfr_max_iterations, wfr_max_iterations_ );
   def< long >( d, names::wfr_interpolation_order, wfr_interpolation_order_ );
+  def< bool >( d, names::measure_update_cost, measure_update_cost_ );
+
+  timer_update_.get_status( d, names::time_update );
+  timer_wfr_.get_status( d, names::time_wfr );
+  timer_secondary_events_.get_status( d, names::time_secondary_events );
+  timer_omp_synchronization_.get_status( d, names::time_omp_synchronization );
+  update_cost_monitor_.get_status( d, names::update_cost );
+  timer_sort_connections_.get_status( d, names::time_sort_connections );
+  timer_prepare_connection_infrastructure_.get_status( d, names::time_prepare_connection_infrastructure );
+  timer_gather_target_data_.get_status( d, names::time_gather_target_data );
 }
 
 void
@@ -421,6 +457,14 @@ nest::SimulationManager::prepare()
     }
   }
 
+  // the number of threads may have changed since the measurement of
+  // update costs was switched on
+  if ( measure_update_cost_
+    and update_cost_monitor_.get_num_threads() != kernel().vp_manager.get_num_threads() )
+  {
+    update_cost_monitor_.reset( kernel().vp_manager.get_num_threads() );
+  }
+
   // if at the beginning of a simulation, set up spike buffers
   if ( not simulated_ )
   {
@@ -455,6 +499,11 @@ nest::SimulationManager::prepare()
       update_connection_infrastructure( tid );
     } // of omp parallel
   }
+
+  // needs to know whether secondary connections exist
+  kernel().event_delivery_manager.configure_spike_exchange_pipeline();
+
+  gather_connection_infrastructure_timers_();
 }
 
 void
@@ -528,21 +577,14 @@ nest::SimulationManager::run( Time const& t )
 
   // Reset profiling timers and counters within event_delivery_manager
   kernel().event_delivery_manager.reset_timers_counters();
+  reset_timers_();
 
   // from_step_ is not touched here.  If we are at the beginning
   // of a simulation, it has been reset properly elsewhere.  If
   // a simulation was ended and is now continued, from_step_ will
   // have the proper value.  to_step_ is set as in advance_time().
 
-  delay end_sim = from_step_ + to_do_;
-  if ( kernel().connection_manager.get_min_delay() < end_sim )
-  {
-    to_step_ = kernel().connection_manager.get_min_delay(); // update to end of time slice
-  }
-  else
-  {
-    to_step_ = end_sim; // update to end of simulation time
-  }
+  to_step_ = get_end_of_update_interval_( from_step_ + to_do_ );
 
   // Warn about possible inconsistencies, see #504.
   // This test cannot come any earlier, because we first need to compute
@@ -577,6 +619,8 @@ nest::SimulationManager::cleanup()
 
   if ( not simulated_ )
   {
+    // neurons attached in prepare() hold their own state again
+    kernel().node_manager.clear_population_engines();
     return;
   }
 
@@ -652,6 +696,11 @@ nest::SimulationManager::call_update_()
   }
 
   kernel().mpi_manager.synchronize();
+  gather_timers_();
+  if ( measure_update_cost_ )
+  {
+    update_cost_monitor_.gather();
+  }
 
   if ( exit_on_user_signal_ )
   {
@@ -665,20 +714,33 @@ nest::SimulationManager::call_update_()
 void
 nest::SimulationManager::update_connection_infrastructure( const thread tid )
 {
+  timer_sort_connections_.start( tid );
   kernel().connection_manager.restructure_connection_tables( tid );
   kernel().connection_manager.sort_connections( tid );
 
 #pragma omp barrier // wait for all threads to finish sorting
+  timer_sort_connections_.stop( tid );
 
+  timer_prepare_connection_infrastructure_.start( tid );
 #pragma omp single
   {
-    kernel().connection_manager.compute_target_data_buffer_size();
-    kernel().event_delivery_manager.resize_send_recv_buffers_target_data();
+    // the sparse exchange allocates its buffers once the exact number of
+    // entries is known
+    if ( not kernel().event_delivery_manager.is_target_data_exchange_sparse() )
+    {
+      kernel().connection_manager.compute_target_data_buffer_size();
+      kernel().event_delivery_manager.resize_send_recv_buffers_target_data();
+    }
 
     // check whether primary and secondary connections exists on any
     // compute node
     kernel().connection_manager.sync_has_primary_connections();
     kernel().connection_manager.check_secondary_connections_exist();
+
+    if ( kernel().connection_manager.use_compressed_spikes() )
+    {
+      kernel().connection_manager.compute_compressed_spike_data();
+    }
   }
 
   if ( kernel().connection_manager.secondary_connections_exist() )
@@ -690,15 +752,18 @@ nest::SimulationManager::update_connection_infrastructure( const thread tid )
       kernel().event_delivery_manager.configure_secondary_buffers();
     }
   }
+  timer_prepare_connection_infrastructure_.stop( tid );
 
   // communicate connection information from postsynaptic to
   // presynaptic side
+  timer_gather_target_data_.start( tid );
   kernel().event_delivery_manager.gather_target_data( tid );
 
   if ( kernel().connection_manager.secondary_connections_exist() )
   {
     kernel().connection_manager.compress_secondary_send_buffer_pos( tid );
   }
+  timer_gather_target_data_.stop( tid );
 
 #pragma omp single
   {
@@ -728,6 +793,11 @@ nest::SimulationManager::update_()
   {
     const thread tid = kernel().vp_manager.get_thread_id();
 
+    if ( measure_update_cost_ )
+    {
+      update_cost_monitor_.prepare_thread( tid, kernel().node_manager.get_nodes_on_thread( tid ).size() );
+    }
+
     do
     {
       if ( print_time_ )
@@ -802,6 +872,7 @@ nest::SimulationManager::update_()
       // wfr
       if ( kernel().connection_manager.secondary_connections_exist() and kernel().node_manager.wfr_is_used() )
       {
+        timer_wfr_.start( tid );
 #pragma omp single
         {
           // if the end of the simulation is in the middle
@@ -835,11 +906,14 @@ nest::SimulationManager::update_()
 // add done value of thread p to done vector
 #pragma omp critical
           done.push_back( done_p );
-// parallel section ends, wait until all threads are done -> synchronize
+          // parallel section ends, wait until all threads are done -> synchronize
+          timer_omp_synchronization_.start( tid );
 #pragma omp barrier
+          timer_omp_synchronization_.stop( tid );
 
-// the following block is executed by a single thread
-// the other threads wait at the end of the block
+          // the following block is executed by a single thread
+          // the other threads wait at the end of the block
+          timer_secondary_events_.start( tid );
 #pragma omp single
           {
             // check whether all threads are done
@@ -860,6 +934,7 @@ nest::SimulationManager::update_()
           // deliver SecondaryEvents generated during wfr_update
           // returns the done value over all threads
           done_p = kernel().event_delivery_manager.deliver_secondary_events( tid, true );
+          timer_secondary_events_.stop( tid );
 
           if ( done_p )
           {
@@ -879,10 +954,33 @@ nest::SimulationManager::update_()
             LOG( M_WARNING, "SimulationManager::wfr_update", msg );
           }
         }
+        timer_wfr_.stop( tid );
 
       } // of if(wfr_is_used)
       // end of preliminary update
 
+      timer_update_.start( tid );
+      if ( measure_update_cost_ )
+      {
+        update_cost_monitor_.start( tid );
+      }
+
+      // neurons attached to population engines are updated by their
+      // engine and skip their own update below
+      try
+      {
+        kernel().node_manager.update_population_engines( tid, clock_, from_step_, to_step_ );
+      }
+      catch ( std::exception& e )
+      {
+        // so throw the exception after parallel region
+        exceptions_raised.at( tid ) = lockPTR< WrappedThreadException >( new WrappedThreadException( e ) );
+      }
+      if ( measure_update_cost_ )
+      {
+        update_cost_monitor_.lap_thread( tid );
+      }
+
       const std::vector< Node* >& thread_local_nodes = kernel().node_manager.get_nodes_on_thread( tid );
       for ( std::vector< Node* >::const_iterator node = thread_local_nodes.begin(); node != thread_local_nodes.end();
             ++node )
@@ -901,28 +999,53 @@ nest::SimulationManager::update_()
           // so throw the exception after parallel region
           exceptions_raised.at( tid ) = lockPTR< WrappedThreadException >( new WrappedThreadException( e ) );
         }
+        if ( measure_update_cost_ )
+        {
+          update_cost_monitor_.lap_node( tid, node - thread_local_nodes.begin() );
+        }
       }
+      timer_update_.stop( tid );
 
-// parallel section ends, wait until all threads are done -> synchronize
+      // parallel section ends, wait until all threads are done -> synchronize
+      timer_omp_synchronization_.start( tid );
 #pragma omp barrier
+      timer_omp_synchronization_.stop( tid );
+      if ( kernel().event_delivery_manager.is_spike_exchange_pipelined() )
+      {
+        // exchange spikes at the split step and at the end of the
+        // slice; delivery of the spikes happens at the next exchange
+        // point
+        if ( kernel().connection_manager.has_primary_connections()
+          and ( to_step_ == kernel().event_delivery_manager.get_spike_exchange_split()
+                or to_step_ == kernel().connection_manager.get_min_delay() ) )
+        {
+          kernel().event_delivery_manager.exchange_spike_data_pipelined( tid );
+        }
+      }
+
       // gather and deliver only at end of slice, i.e., end of min_delay step
       if ( to_step_ == kernel().connection_manager.get_min_delay() )
       {
-        if ( kernel().connection_manager.has_primary_connections() )
+        if ( kernel().connection_manager.has_primary_connections()
+          and not kernel().event_delivery_manager.is_spike_exchange_pipelined() )
         {
           kernel().event_delivery_manager.gather_spike_data( tid );
         }
         if ( kernel().connection_manager.secondary_connections_exist() )
         {
+          timer_secondary_events_.start( tid );
 #pragma omp single
           {
             kernel().event_delivery_manager.gather_secondary_events( true );
           }
           kernel().event_delivery_manager.deliver_secondary_events( tid, false );
+          timer_secondary_events_.stop( tid );
         }
       }
 
+      timer_omp_synchronization_.start( tid );
 #pragma omp barrier
+      timer_omp_synchronization_.stop( tid );
 
 // the following block is executed by the master thread only
 // the other threads are enforced to wait at the end of the block
@@ -942,11 +1065,17 @@ nest::SimulationManager::update_()
           print_progress_();
         }
       }
-// end of master section, all threads have to synchronize at this point
+      // end of master section, all threads have to synchronize at this point
+      timer_omp_synchronization_.start( tid );
 #pragma omp barrier
+      timer_omp_synchronization_.stop( tid );
 
     } while ( to_do_ > 0 and not exit_on_user_signal_ and not exceptions_raised.at( tid ) );
 
+    // deliver spikes of a pending pipelined exchange, such that no
+    // communication is left open between runs
+    kernel().event_delivery_manager.complete_pipelined_spike_exchange( tid );
+
     // End of the slice, we update the number of synaptic elements
     for ( std::vector< Node* >::const_iterator i = kernel().node_manager.get_nodes_on_thread( tid ).begin();
           i != kernel().node_manager.get_nodes_on_thread( tid ).end();
@@ -1006,19 +1135,69 @@ nest::SimulationManager::advance_time_()
     from_step_ = to_step_;
   }
 
-  long end_sim = from_step_ + to_do_;
+  to_step_ = get_end_of_update_interval_( from_step_ + to_do_ );
 
-  if ( kernel().connection_manager.get_min_delay() < ( delay ) end_sim )
-  {
-    // update to end of time slice
-    to_step_ = kernel().connection_manager.get_min_delay();
-  }
-  else
+  assert( to_step_ - from_step_ <= ( long ) kernel().connection_manager.get_min_delay() );
+}
+
+nest::delay
+nest::SimulationManager::get_end_of_update_interval_( const delay end_sim ) const
+{
+  // update to end of time slice
+  delay end_of_interval = kernel().connection_manager.get_min_delay();
+
+  // if spike communication is pipelined, the first part of the slice is
+  // updated separately to overlap its communication with the update of
+  // the second part
+  const delay split = kernel().event_delivery_manager.get_spike_exchange_split();
+  if ( split > 0 and from_step_ < split )
   {
-    to_step_ = end_sim; // update to end of simulation time
+    end_of_interval = split;
   }
 
-  assert( to_step_ - from_step_ <= ( long ) kernel().connection_manager.get_min_delay() );
+  // update to end of simulation time
+  return std::min( end_of_interval, end_sim );
+}
+
+void
+nest::SimulationManager::reset_timers_()
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  timer_update_.reset( num_threads );
+  timer_wfr_.reset( num_threads );
+  timer_secondary_events_.reset( num_threads );
+  timer_omp_synchronization_.reset( num_threads );
+}
+
+void
+nest::SimulationManager::gather_timers_()
+{
+  timer_update_.gather();
+  timer_wfr_.gather();
+  timer_secondary_events_.gather();
+  timer_omp_synchronization_.gather();
+  kernel().event_delivery_manager.gather_timers();
+
+  // structural plasticity updates the connection infrastructure during
+  // the run
+  gather_connection_infrastructure_timers_();
+}
+
+void
+nest::SimulationManager::reset_connection_infrastructure_timers()
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  timer_sort_connections_.reset( num_threads );
+  timer_prepare_connection_infrastructure_.reset( num_threads );
+  timer_gather_target_data_.reset( num_threads );
+}
+
+void
+nest::SimulationManager::gather_connection_infrastructure_timers_()
+{
+  timer_sort_connections_.gather();
+  timer_prepare_connection_infrastructure_.gather();
+  timer_gather_target_data_.gather();
 }
 
 void
@@ -35,6 +35,8 @@
 // Includes from nestkernel:
 #include "nest_time.h"
 #include "nest_types.h"
+#include "phase_timer.h"
+#include "update_cost_monitor.h"
 
 // Includes from sli:
 #include "dictdatum.h"
@@ -90,6 +92,12 @@ public:
    */
   void simulate( Time const& );
 
+  /**
+   * Discard the time measurements of the connection infrastructure and
+   * set up the timers for the current number of threads.
+   */
+  void reset_connection_infrastructure_timers();
+
   /**
    * Returns true if waveform relaxation is used.
    */
@@ -165,7 +173,15 @@ private:
   void update_();      //! actually perform simulation
   bool wfr_update_( Node* );
   void advance_time_();   //!< Update time to next time step
+  //! Return the step up to which nodes are updated in the next iteration
+  delay get_end_of_update_interval_( const delay end_sim ) const;
   void print_progress_(); //!< TODO: Remove, replace by logging!
+  void reset_timers_();   //!< Discard time measurements of the previous run
+  void gather_timers_();  //!< Collect time measurements across MPI processes
+
+  //! Collect time measurements of the connection infrastructure across MPI
+  //! processes
+  void gather_connection_infrastructure_timers_();
 
   Time clock_;               //!< SimulationManager clock, updated once per slice
   delay slice_;              //!< current update slice
@@ -195,6 +211,26 @@ private:
                                    //!< relaxation
   size_t wfr_interpolation_order_; //!< interpolation order for waveform
                                    //!< relaxation method
+
+  PhaseTimer timer_update_;              //!< Time spent updating nodes
+  PhaseTimer timer_wfr_;                 //!< Time spent in waveform relaxation
+                                         //!< iterations
+  PhaseTimer timer_secondary_events_;    //!< Time spent exchanging and
+                                         //!< delivering secondary events
+  PhaseTimer timer_omp_synchronization_; //!< Time spent waiting in barriers
+                                         //!< of the update loop
+
+  bool measure_update_cost_;              //!< Whether the update cost of each
+                                          //!< node is measured
+  UpdateCostMonitor update_cost_monitor_; //!< Update cost of nodes and
+                                          //!< threads
+
+  PhaseTimer timer_sort_connections_;                  //!< Time spent sorting
+                                                       //!< connections by source
+  PhaseTimer timer_prepare_connection_infrastructure_; //!< Time spent sizing
+                                                       //!< buffers and tables
+  PhaseTimer timer_gather_target_data_;                //!< Time spent exchanging
+                                                       //!< connection information
 };
 
 inline Time const&
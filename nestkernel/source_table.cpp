@@ -73,6 +73,7 @@ nest::SourceTable::finalize()
   sources_.clear();
   current_positions_.clear();
   saved_positions_.clear();
+  compressed_spike_data_map_.clear();
 }
 
 bool
@@ -265,6 +266,77 @@ nest::SourceTable::compute_buffer_pos_for_unique_secondary_sources( const thread
   } // of omp single
 }
 
+void
+nest::SourceTable::fill_compressed_spike_data(
+  std::vector< std::vector< std::vector< index > > >& compressed_spike_data )
+{
+  const thread num_threads = kernel().vp_manager.get_num_threads();
+  const synindex num_syn_ids = kernel().model_manager.get_num_synapse_prototypes();
+
+  compressed_spike_data.clear();
+  compressed_spike_data.resize( num_syn_ids );
+  compressed_spike_data_map_.clear();
+  compressed_spike_data_map_.resize( num_syn_ids );
+
+  for ( synindex syn_id = 0; syn_id < num_syn_ids; ++syn_id )
+  {
+    if ( not kernel().model_manager.get_synapse_prototype( syn_id, 0 ).is_primary() )
+    {
+      continue;
+    }
+
+    for ( thread tid = 0; tid < num_threads; ++tid )
+    {
+      if ( syn_id >= sources_[ tid ].size() )
+      {
+        continue;
+      }
+
+      // sources are sorted, hence all connections of a source follow
+      // the first one, which is the one we store
+      index last_source_gid = 0;
+      index lcid = 0;
+      for ( BlockVector< Source >::const_iterator cit = sources_[ tid ][ syn_id ].begin();
+            cit != sources_[ tid ][ syn_id ].end();
+            ++cit, ++lcid )
+      {
+        const index source_gid = cit->get_gid();
+        if ( source_gid == last_source_gid )
+        {
+          continue;
+        }
+        last_source_gid = source_gid;
+
+        const std::pair< std::map< index, size_t >::iterator, bool > inserted =
+          compressed_spike_data_map_[ syn_id ].insert(
+            std::make_pair( source_gid, compressed_spike_data[ syn_id ].size() ) );
+        if ( inserted.second )
+        {
+          compressed_spike_data[ syn_id ].push_back( std::vector< index >( num_threads, invalid_index ) );
+        }
+        compressed_spike_data[ syn_id ][ inserted.first->second ][ tid ] = lcid;
+      }
+    }
+  }
+}
+
+bool
+nest::SourceTable::is_first_compressed_target_thread_( const thread tid,
+  const std::vector< std::vector< std::vector< index > > >& compressed_spike_data,
+  const synindex syn_id,
+  const size_t idx ) const
+{
+  const std::vector< index >& lcids = compressed_spike_data[ syn_id ][ idx ];
+  for ( thread t = 0; t < tid; ++t )
+  {
+    if ( lcids[ t ] != invalid_index )
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
 void
 nest::SourceTable::resize_sources( const thread tid )
 {
@@ -343,6 +415,18 @@ nest::SourceTable::get_next_target_data( const thread tid,
       --current_position.lcid;
       continue;
     }
+    // with compressed spikes, the source is communicated only once
+    // per synapse type by the first thread that has targets of it;
+    // the receiving rank expands it to all threads
+    else if ( current_source.is_primary() and kernel().connection_manager.use_compressed_spikes()
+      and not is_first_compressed_target_thread_( current_position.tid,
+                kernel().connection_manager.get_compressed_spike_data(),
+                current_position.syn_id,
+                compressed_spike_data_map_[ current_position.syn_id ].find( current_source.get_gid() )->second ) )
+    {
+      --current_position.lcid;
+      continue;
+    }
     // otherwise we return a valid TargetData
     else
     {
@@ -359,7 +443,17 @@ nest::SourceTable::get_next_target_data( const thread tid,
         TargetDataFields& target_fields = next_target_data.target_data;
         target_fields.set_tid( current_position.tid );
         target_fields.set_syn_id( current_position.syn_id );
-        target_fields.set_lcid( current_position.lcid );
+        if ( kernel().connection_manager.use_compressed_spikes() )
+        {
+          // the spike carries the index into the compressed spike data
+          // of the receiving rank instead of a local connection id
+          target_fields.set_lcid(
+            compressed_spike_data_map_[ current_position.syn_id ].find( current_source.get_gid() )->second );
+        }
+        else
+        {
+          target_fields.set_lcid( current_position.lcid );
+        }
       }
       else
       {
@@ -94,6 +94,25 @@ private:
    */
   static const size_t min_deleted_elements_ = 1000000;
 
+  /**
+   * Maps, per synapse type, the global id of each source that has
+   * primary connections on this rank to its index in the compressed
+   * spike data.
+   *
+   * @see ConnectionManager::compute_compressed_spike_data()
+   */
+  std::vector< std::map< index, size_t > > compressed_spike_data_map_;
+
+  /**
+   * Returns whether the given thread is the first thread on this rank
+   * that has targets of the compressed source idx. Only this thread
+   * communicates the source to the presynaptic side.
+   */
+  bool is_first_compressed_target_thread_( const thread tid,
+    const std::vector< std::vector< std::vector< index > > >& compressed_spike_data,
+    const synindex syn_id,
+    const size_t idx ) const;
+
 public:
   SourceTable();
   ~SourceTable();
@@ -201,6 +220,15 @@ public:
   void compute_buffer_pos_for_unique_secondary_sources( const thread tid,
     std::map< index, size_t >& buffer_pos_of_source_gid_syn_id_ );
 
+  /**
+   * Assigns a rank-wide index to each unique combination of source
+   * GID and synapse type for primary connections and stores, for each
+   * index and thread, the local connection id of the first connection
+   * of this source. Thread-local connections must be sorted by source.
+   * Must be called by a single thread.
+   */
+  void fill_compressed_spike_data( std::vector< std::vector< std::vector< index > > >& compressed_spike_data );
+
   /**
    * Finds the first entry in sources_ at the given thread id and
    * synapse type that is equal to sgid.
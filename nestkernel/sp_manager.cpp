@@ -786,6 +786,10 @@ nest::SPManager::enable_structural_plasticity()
       "Structural plasticity can not be enabled if sort_connections_by_source "
       "has been set to false." );
   }
+  if ( kernel().connection_manager.use_compressed_spikes() )
+  {
+    throw KernelException( "Structural plasticity can not be enabled if use_compressed_spikes is set to true." );
+  }
   structural_plasticity_enabled_ = true;
 }
 
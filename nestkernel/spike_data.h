@@ -27,6 +27,7 @@
 #include <cassert>
 
 // Includes from nestkernel:
+#include "nest_time.h"
 #include "nest_types.h"
 #include "target.h"
 
@@ -305,6 +306,20 @@ OffGridSpikeData::get_offset() const
   return offset_;
 }
 
+/**
+ * A received spike waiting to be delivered through the connection at
+ * position lcid_ of a connector and the subsequent connections with the
+ * same source. Used to pass all spikes of a synapse type to its
+ * connector at once.
+ */
+struct PendingSpike
+{
+  index lcid_;       //!< local connection index
+  index sender_gid_; //!< gid of the source of the connection
+  Time stamp_;       //!< time stamp of the spike
+  double offset_;    //!< precise spike time offset
+};
+
 } // namespace nest
 
 #endif /* SPIKE_DATA_H */
@@ -0,0 +1,855 @@
+/*
+ *  static_connector.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef STATIC_CONNECTOR_H
+#define STATIC_CONNECTOR_H
+
+// C++ includes:
+#include <vector>
+
+// Includes from libnestutil:
+#include "block_vector.h"
+#include "sort.h"
+#include "static_assert.h"
+
+// Includes from nestkernel:
+#include "connector_base.h"
+#include "exceptions.h"
+#include "nest_time.h"
+#include "nest_types.h"
+#include "syn_id_delay.h"
+#include "target_identifier.h"
+
+namespace nest
+{
+
+/**
+ * Target columns of a StaticConnector, which store the target
+ * identifier and the synapse type, delay and flags of each connection.
+ */
+template < typename TargetIdentifierT >
+class TargetColumns
+{
+private:
+  BlockVector< TargetIdentifierT > targets_;
+  BlockVector< SynIdDelay > syn_id_delays_;
+
+public:
+  typedef std::pair< TargetIdentifierT, SynIdDelay > EntryType;
+
+  size_t
+  size() const
+  {
+    return targets_.size();
+  }
+
+  template < typename ConnectionT >
+  void
+  push_back( const ConnectionT& c )
+  {
+    targets_.push_back( c.get_target_identifier() );
+    syn_id_delays_.push_back( c.get_syn_id_delay() );
+  }
+
+  template < typename ConnectionT >
+  void
+  load( const index lcid, ConnectionT& c ) const
+  {
+    c.set_target_identifier( targets_[ lcid ] );
+    c.set_syn_id_delay( syn_id_delays_[ lcid ] );
+  }
+
+  template < typename ConnectionT >
+  void
+  store( const index lcid, const ConnectionT& c )
+  {
+    targets_[ lcid ] = c.get_target_identifier();
+    syn_id_delays_[ lcid ] = c.get_syn_id_delay();
+  }
+
+  Node*
+  get_target_ptr( const thread tid, const index lcid ) const
+  {
+    return targets_[ lcid ].get_target_ptr( tid );
+  }
+
+  rport
+  get_rport( const index lcid ) const
+  {
+    return targets_[ lcid ].get_rport();
+  }
+
+  long
+  get_delay_steps( const index lcid ) const
+  {
+    return syn_id_delays_[ lcid ].delay;
+  }
+
+  bool
+  is_disabled( const index lcid ) const
+  {
+    return syn_id_delays_[ lcid ].is_disabled();
+  }
+
+  bool
+  has_source_subsequent_targets( const index lcid ) const
+  {
+    return syn_id_delays_[ lcid ].has_source_subsequent_targets();
+  }
+
+  void
+  set_has_source_subsequent_targets( const index lcid, const bool subsequent_targets )
+  {
+    syn_id_delays_[ lcid ].set_has_source_subsequent_targets( subsequent_targets );
+  }
+
+  void
+  disable( const index lcid )
+  {
+    syn_id_delays_[ lcid ].disable();
+  }
+
+  EntryType
+  save( const index lcid ) const
+  {
+    return EntryType( targets_[ lcid ], syn_id_delays_[ lcid ] );
+  }
+
+  void
+  restore( const index lcid, const EntryType& entry )
+  {
+    targets_[ lcid ] = entry.first;
+    syn_id_delays_[ lcid ] = entry.second;
+  }
+
+  void
+  move( const index to, const index from )
+  {
+    targets_[ to ] = targets_[ from ];
+    syn_id_delays_[ to ] = syn_id_delays_[ from ];
+  }
+
+  void
+  erase( const index first )
+  {
+    targets_.erase( targets_.begin() + first, targets_.end() );
+    syn_id_delays_.erase( syn_id_delays_.begin() + first, syn_id_delays_.end() );
+  }
+
+  void
+  clear()
+  {
+    targets_.clear();
+    syn_id_delays_.clear();
+  }
+};
+
+/**
+ * Target column of a StaticConnector for connections with thread-local
+ * target indices, which packs target index, delay and flags into 32
+ * bits. The synapse type is known from the connector, and delays are
+ * limited to MAX_DELAY steps.
+ */
+class CompactTargets
+{
+public:
+  static constexpr uint8_t NUM_BITS_DELAY = 14U;
+  static constexpr long MAX_DELAY = generate_max_value( NUM_BITS_DELAY );
+
+  struct EntryType
+  {
+    TargetIdentifierIndex target;
+    unsigned short delay : NUM_BITS_DELAY;
+    bool subsequent_targets : 1;
+    bool disabled : 1;
+  };
+
+private:
+  BlockVector< EntryType > entries_;
+
+  static void
+  assert_valid_delay_( const long delay_steps )
+  {
+    if ( delay_steps > MAX_DELAY )
+    {
+      throw BadDelay( Time::delay_steps_to_ms( delay_steps ),
+        "Delay must be smaller than or equal to the maximal delay of compact synapses" );
+    }
+  }
+
+  template < typename ConnectionT >
+  static EntryType
+  pack_( const ConnectionT& c )
+  {
+    const SynIdDelay& syn_id_delay = c.get_syn_id_delay();
+    assert_valid_delay_( syn_id_delay.delay );
+
+    EntryType entry;
+    entry.target = c.get_target_identifier();
+    entry.delay = syn_id_delay.delay;
+    entry.subsequent_targets = syn_id_delay.has_source_subsequent_targets();
+    entry.disabled = syn_id_delay.is_disabled();
+    return entry;
+  }
+
+public:
+  size_t
+  size() const
+  {
+    return entries_.size();
+  }
+
+  template < typename ConnectionT >
+  void
+  push_back( const ConnectionT& c )
+  {
+    entries_.push_back( pack_( c ) );
+  }
+
+  template < typename ConnectionT >
+  void
+  load( const index lcid, ConnectionT& c ) const
+  {
+    const EntryType& entry = entries_[ lcid ];
+    SynIdDelay syn_id_delay;
+    syn_id_delay.delay = entry.delay;
+    syn_id_delay.set_has_source_subsequent_targets( entry.subsequent_targets );
+    if ( entry.disabled )
+    {
+      syn_id_delay.disable();
+    }
+    c.set_target_identifier( entry.target );
+    c.set_syn_id_delay( syn_id_delay );
+  }
+
+  template < typename ConnectionT >
+  void
+  store( const index lcid, const ConnectionT& c )
+  {
+    entries_[ lcid ] = pack_( c );
+  }
+
+  Node*
+  get_target_ptr( const thread tid, const index lcid ) const
+  {
+    return entries_[ lcid ].target.get_target_ptr( tid );
+  }
+
+  rport
+  get_rport( const index ) const
+  {
+    return 0;
+  }
+
+  long
+  get_delay_steps( const index lcid ) const
+  {
+    return entries_[ lcid ].delay;
+  }
+
+  bool
+  is_disabled( const index lcid ) const
+  {
+    return entries_[ lcid ].disabled;
+  }
+
+  bool
+  has_source_subsequent_targets( const index lcid ) const
+  {
+    return entries_[ lcid ].subsequent_targets;
+  }
+
+  void
+  set_has_source_subsequent_targets( const index lcid, const bool subsequent_targets )
+  {
+    entries_[ lcid ].subsequent_targets = subsequent_targets;
+  }
+
+  void
+  disable( const index lcid )
+  {
+    entries_[ lcid ].disabled = true;
+  }
+
+  EntryType
+  save( const index lcid ) const
+  {
+    return entries_[ lcid ];
+  }
+
+  void
+  restore( const index lcid, const EntryType& entry )
+  {
+    entries_[ lcid ] = entry;
+  }
+
+  void
+  move( const index to, const index from )
+  {
+    entries_[ to ] = entries_[ from ];
+  }
+
+  void
+  erase( const index first )
+  {
+    entries_.erase( entries_.begin() + first, entries_.end() );
+  }
+
+  void
+  clear()
+  {
+    entries_.clear();
+  }
+};
+
+//! check legal size
+using success_compact_target_size = StaticAssert< sizeof( CompactTargets::EntryType ) == 4 >::success;
+
+/**
+ * Weight column of a StaticConnector for connections with individual
+ * weights, stored with the precision of WeightT.
+ */
+template < typename WeightT >
+class IndividualWeights
+{
+private:
+  BlockVector< WeightT > weights_;
+
+public:
+  template < typename ConnectionT >
+  void
+  push_back( const ConnectionT& c )
+  {
+    weights_.push_back( c.get_weight() );
+  }
+
+  template < typename ConnectionT >
+  void
+  load( const index lcid, ConnectionT& c ) const
+  {
+    c.set_weight( weights_[ lcid ] );
+  }
+
+  template < typename ConnectionT >
+  void
+  store( const index lcid, const ConnectionT& c )
+  {
+    weights_[ lcid ] = c.get_weight();
+  }
+
+  template < typename CommonPropertiesT >
+  double
+  get( const index lcid, const CommonPropertiesT& ) const
+  {
+    return weights_[ lcid ];
+  }
+
+  double
+  save( const index lcid ) const
+  {
+    return weights_[ lcid ];
+  }
+
+  void
+  restore( const index lcid, const double weight )
+  {
+    weights_[ lcid ] = weight;
+  }
+
+  void
+  move( const index to, const index from )
+  {
+    weights_[ to ] = weights_[ from ];
+  }
+
+  void
+  erase( const index first )
+  {
+    weights_.erase( weights_.begin() + first, weights_.end() );
+  }
+
+  void
+  clear()
+  {
+    weights_.clear();
+  }
+};
+
+/**
+ * Weight column of a StaticConnector for connections that share the
+ * weight stored in their common properties. Nothing is stored per
+ * connection.
+ */
+class HomogeneousWeight
+{
+public:
+  template < typename ConnectionT >
+  void
+  push_back( const ConnectionT& )
+  {
+  }
+
+  template < typename ConnectionT >
+  void
+  load( const index, ConnectionT& ) const
+  {
+  }
+
+  template < typename ConnectionT >
+  void
+  store( const index, const ConnectionT& )
+  {
+  }
+
+  template < typename CommonPropertiesT >
+  double
+  get( const index, const CommonPropertiesT& cp ) const
+  {
+    return cp.get_weight();
+  }
+
+  double
+  save( const index ) const
+  {
+    return 0.0;
+  }
+
+  void
+  restore( const index, const double )
+  {
+  }
+
+  void
+  move( const index, const index )
+  {
+  }
+
+  void
+  erase( const index )
+  {
+  }
+
+  void
+  clear()
+  {
+  }
+};
+
+/**
+ * Connector for static synapses, which stores targets, delays and
+ * flags, and weights in separate contiguous columns instead of an array
+ * of connection objects. When a spike is delivered to the subsequent
+ * targets of a source, each column is read sequentially.
+ *
+ * Connection objects are only assembled from the columns to read or
+ * change the status of individual connections. ConnectionT must provide
+ * get_target_identifier() and get_syn_id_delay() and the corresponding
+ * setters; TargetsT is either TargetColumns or CompactTargets, WeightsT
+ * is either IndividualWeights or HomogeneousWeight.
+ */
+template < typename ConnectionT, typename TargetsT, typename WeightsT >
+class StaticConnector : public ConnectorBase
+{
+private:
+  TargetsT targets_;
+  WeightsT weights_;
+  const synindex syn_id_;
+
+  //! number of connections at the front of the columns that are sorted
+  //! by source
+  index num_sorted_;
+
+  /**
+   * Assembles the connection at position lcid from the columns.
+   */
+  ConnectionT
+  get_connection_( const index lcid ) const
+  {
+    ConnectionT c;
+    targets_.load( lcid, c );
+    c.set_syn_id( syn_id_ );
+    weights_.load( lcid, c );
+    return c;
+  }
+
+  /**
+   * Stores the connection c at position lcid in the columns.
+   */
+  void
+  set_connection_( const index lcid, const ConnectionT& c )
+  {
+    targets_.store( lcid, c );
+    weights_.store( lcid, c );
+  }
+
+  Node*
+  get_target_( const thread tid, const index lcid ) const
+  {
+    return targets_.get_target_ptr( tid, lcid );
+  }
+
+  void
+  send_( const thread tid,
+    const index lcid,
+    Event& e,
+    const typename ConnectionT::CommonPropertiesType& cp ) const
+  {
+    e.set_weight( weights_.get( lcid, cp ) );
+    e.set_delay_steps( targets_.get_delay_steps( lcid ) );
+    e.set_receiver( *targets_.get_target_ptr( tid, lcid ) );
+    e.set_rport( targets_.get_rport( lcid ) );
+    e();
+  }
+
+public:
+  explicit StaticConnector( const synindex syn_id )
+    : syn_id_( syn_id )
+    , num_sorted_( 0 )
+  {
+  }
+
+  ~StaticConnector()
+  {
+    targets_.clear();
+    weights_.clear();
+  }
+
+  synindex
+  get_syn_id() const
+  {
+    return syn_id_;
+  }
+
+  size_t
+  size() const
+  {
+    return targets_.size();
+  }
+
+  void
+  get_synapse_status( const thread tid, const index lcid, DictionaryDatum& dict ) const
+  {
+    assert( lcid >= 0 and lcid < size() );
+
+    get_connection_( lcid ).get_status( dict );
+
+    // get target gid here, where tid is available
+    // necessary for hpc synapses using TargetIdentifierIndex
+    def< long >( dict, names::target, get_target_( tid, lcid )->get_gid() );
+  }
+
+  void
+  set_synapse_status( const index lcid, const DictionaryDatum& dict, ConnectorModel& cm )
+  {
+    assert( lcid < size() );
+
+    ConnectionT c = get_connection_( lcid );
+    c.set_status( dict, static_cast< GenericConnectorModel< ConnectionT >& >( cm ) );
+    set_connection_( lcid, c );
+  }
+
+  StaticConnector< ConnectionT, TargetsT, WeightsT >&
+  push_back( const ConnectionT& c )
+  {
+    targets_.push_back( c );
+    weights_.push_back( c );
+    return *this;
+  }
+
+  void
+  get_connection( const index source_gid,
+    const index target_gid,
+    const thread tid,
+    const index lcid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const
+  {
+    // static synapses carry no label
+    if ( not targets_.is_disabled( lcid ) and synapse_label == UNLABELED_CONNECTION )
+    {
+      const index current_target_gid = get_target_( tid, lcid )->get_gid();
+      if ( current_target_gid == target_gid or target_gid == 0 )
+      {
+        conns.push_back( ConnectionDatum( ConnectionID( source_gid, current_target_gid, tid, syn_id_, lcid ) ) );
+      }
+    }
+  }
+
+  void
+  get_connection_with_specified_targets( const index source_gid,
+    const std::vector< size_t >& target_neuron_gids,
+    const thread tid,
+    const index lcid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const
+  {
+    if ( not targets_.is_disabled( lcid ) and synapse_label == UNLABELED_CONNECTION )
+    {
+      const index current_target_gid = get_target_( tid, lcid )->get_gid();
+      if ( std::find( target_neuron_gids.begin(), target_neuron_gids.end(), current_target_gid )
+        != target_neuron_gids.end() )
+      {
+        conns.push_back( ConnectionDatum( ConnectionID( source_gid, current_target_gid, tid, syn_id_, lcid ) ) );
+      }
+    }
+  }
+
+  void
+  get_all_connections( const index source_gid,
+    const index target_gid,
+    const thread tid,
+    const long synapse_label,
+    std::deque< ConnectionID >& conns ) const
+  {
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      get_connection( source_gid, target_gid, tid, lcid, synapse_label, conns );
+    }
+  }
+
+  void
+  get_source_lcids( const thread tid, const index target_gid, std::vector< index >& source_lcids ) const
+  {
+    for ( index lcid = 0; lcid < size(); ++lcid )
+    {
+      if ( get_target_( tid, lcid )->get_gid() == target_gid and not targets_.is_disabled( lcid ) )
+      {
+        source_lcids.push_back( lcid );
+      }
+    }
+  }
+
+  void
+  get_target_gids( const thread tid,
+    const index start_lcid,
+    const std::string& post_synaptic_element,
+    std::vector< index >& target_gids ) const
+  {
+    index lcid = start_lcid;
+    while ( true )
+    {
+      if ( get_target_( tid, lcid )->get_synaptic_elements( post_synaptic_element ) != 0.0
+        and not targets_.is_disabled( lcid ) )
+      {
+        target_gids.push_back( get_target_( tid, lcid )->get_gid() );
+      }
+
+      if ( not targets_.has_source_subsequent_targets( lcid ) )
+      {
+        break;
+      }
+
+      ++lcid;
+    }
+  }
+
+  index
+  get_target_gid( const thread tid, const unsigned int lcid ) const
+  {
+    return get_target_( tid, lcid )->get_gid();
+  }
+
+  void
+  send_to_all( const thread tid, const std::vector< ConnectorModel* >& cm, Event& e )
+  {
+    typename ConnectionT::CommonPropertiesType const& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    for ( size_t lcid = 0; lcid < size(); ++lcid )
+    {
+      e.set_port( lcid );
+      assert( not targets_.is_disabled( lcid ) );
+      send_( tid, lcid, e, cp );
+    }
+  }
+
+  index
+  send( const thread tid, const index lcid, const std::vector< ConnectorModel* >& cm, Event& e )
+  {
+    typename ConnectionT::CommonPropertiesType const& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    index current_lcid = lcid;
+    while ( true )
+    {
+      e.set_port( current_lcid );
+      if ( not targets_.is_disabled( current_lcid ) )
+      {
+        send_( tid, current_lcid, e, cp );
+        send_weight_event( tid, current_lcid, e, cp );
+      }
+      if ( not targets_.has_source_subsequent_targets( current_lcid ) )
+      {
+        break;
+      }
+      ++current_lcid;
+    }
+
+    return 1 + current_lcid - lcid; // event was delivered to at least one target
+  }
+
+  void
+  send_batch( const thread tid,
+    const PendingSpike* first,
+    const PendingSpike* const last,
+    const std::vector< ConnectorModel* >& cm,
+    Event& e )
+  {
+    for ( ; first != last; ++first )
+    {
+      e.set_stamp( first->stamp_ );
+      e.set_offset( first->offset_ );
+      e.set_sender_gid( first->sender_gid_ );
+      StaticConnector::send( tid, first->lcid_, cm, e );
+    }
+  }
+
+  // Implemented in connector_base_impl.h
+  void send_weight_event( const thread tid, const unsigned int lcid, Event& e, const CommonSynapseProperties& cp );
+
+  void
+  trigger_update_weight( const long vt_gid,
+    const thread tid,
+    const std::vector< spikecounter >& dopa_spikes,
+    const double t_trig,
+    const std::vector< ConnectorModel* >& cm )
+  {
+    typename ConnectionT::CommonPropertiesType const& cp =
+      static_cast< GenericConnectorModel< ConnectionT >* >( cm[ syn_id_ ] )->get_common_properties();
+
+    for ( size_t i = 0; i < size(); ++i )
+    {
+      if ( cp.get_vt_gid() == vt_gid )
+      {
+        ConnectionT c = get_connection_( i );
+        c.trigger_update_weight( tid, dopa_spikes, t_trig, cp );
+        set_connection_( i, c );
+      }
+    }
+  }
+
+  void
+  sort_connections( BlockVector< Source >& sources )
+  {
+    if ( num_sorted_ == sources.size() )
+    {
+      return;
+    }
+
+    // sort a permutation along with the sources and apply it to all
+    // columns by following its cycles
+    BlockVector< index > permutation;
+    for ( index lcid = 0; lcid < sources.size(); ++lcid )
+    {
+      permutation.push_back( lcid );
+    }
+    nest::sort_incrementally( sources, permutation, num_sorted_ );
+    num_sorted_ = sources.size();
+
+    std::vector< bool > is_moved( permutation.size(), false );
+    for ( index start = 0; start < permutation.size(); ++start )
+    {
+      if ( is_moved[ start ] or permutation[ start ] == start )
+      {
+        continue;
+      }
+
+      const typename TargetsT::EntryType target = targets_.save( start );
+      const double weight = weights_.save( start );
+
+      index to = start;
+      while ( permutation[ to ] != start )
+      {
+        const index from = permutation[ to ];
+        targets_.move( to, from );
+        weights_.move( to, from );
+        is_moved[ to ] = true;
+        to = from;
+      }
+      targets_.restore( to, target );
+      weights_.restore( to, weight );
+      is_moved[ to ] = true;
+    }
+  }
+
+  void
+  set_has_source_subsequent_targets( const index lcid, const bool has_subsequent_targets )
+  {
+    targets_.set_has_source_subsequent_targets( lcid, has_subsequent_targets );
+  }
+
+  index
+  find_first_target( const thread tid, const index start_lcid, const index target_gid ) const
+  {
+    index lcid = start_lcid;
+    while ( true )
+    {
+      if ( get_target_( tid, lcid )->get_gid() == target_gid and not targets_.is_disabled( lcid ) )
+      {
+        return lcid;
+      }
+
+      if ( not targets_.has_source_subsequent_targets( lcid ) )
+      {
+        return invalid_index;
+      }
+
+      ++lcid;
+    }
+  }
+
+  index
+  find_matching_target( const thread tid, const std::vector< index >& matching_lcids, const index target_gid ) const
+  {
+    for ( size_t i = 0; i < matching_lcids.size(); ++i )
+    {
+      if ( get_target_( tid, matching_lcids[ i ] )->get_gid() == target_gid )
+      {
+        return matching_lcids[ i ];
+      }
+    }
+
+    return invalid_index;
+  }
+
+  void
+  disable_connection( const index lcid )
+  {
+    assert( not targets_.is_disabled( lcid ) );
+    targets_.disable( lcid );
+    // disabled connections are sorted to the end
+    num_sorted_ = std::min( num_sorted_, lcid );
+  }
+
+  void
+  remove_disabled_connections( const index first_disabled_index )
+  {
+    assert( targets_.is_disabled( first_disabled_index ) );
+    targets_.erase( first_disabled_index );
+    weights_.erase( first_disabled_index );
+    num_sorted_ = std::min( num_sorted_, first_disabled_index );
+  }
+};
+
+} // of namespace nest
+
+#endif
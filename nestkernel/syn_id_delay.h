@@ -26,6 +26,7 @@
 // Includes from nestkernel:
 #include "nest_time.h"
 #include "nest_types.h"
+#include "static_assert.h"
 
 namespace nest
 {
@@ -37,6 +38,14 @@ struct SynIdDelay
   bool subsequent_targets : 1;
   bool disabled : 1;
 
+  SynIdDelay()
+    : delay( 0 )
+    , syn_id( invalid_synindex )
+    , subsequent_targets( false )
+    , disabled( false )
+  {
+  }
+
   explicit SynIdDelay( double d )
     : syn_id( invalid_synindex )
     , subsequent_targets( false )
@@ -0,0 +1,219 @@
+/*
+ *  trace_buffer.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TRACE_BUFFER_H
+#define TRACE_BUFFER_H
+
+// C++ includes:
+#include <cassert>
+#include <vector>
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+namespace nest
+{
+
+/**
+ * Ring buffer of the most recent spike times of a neuron and the values
+ * of its postsynaptic trace at these times.
+ *
+ * The buffer holds at most capacity() entries in order of increasing
+ * time. When a spike is added to a full buffer, the oldest entry is
+ * dropped, so the memory per neuron is bounded independently of the
+ * number of incoming synapses and the firing rate. In addition to the
+ * stored entries, the buffer remembers the most recently dropped entry,
+ * which is all that is needed to evaluate the trace at times before the
+ * oldest stored spike. Entries are addressed by index, 0 being the
+ * oldest, and searched by bisection.
+ *
+ * The buffer is part of the definition of Archiving_Node, but lives in a
+ * separate file to avoid circular inclusion in node.h.
+ */
+class TraceBuffer
+{
+public:
+  //! Spike time and value of the trace just after the spike
+  struct Entry
+  {
+    double t_;      //!< point in time when spike occurred (in ms)
+    double Kminus_; //!< value of Kminus at that time
+  };
+
+  TraceBuffer();
+
+  /**
+   * Sets the number of entries the buffer can hold. Discards all entries.
+   */
+  void resize( const size_t capacity );
+
+  /**
+   * Discards all entries, including the last dropped one.
+   */
+  void clear();
+
+  /**
+   * Appends an entry, dropping the oldest entry if the buffer is full.
+   * Times must not decrease.
+   */
+  void push_back( const double t, const double Kminus );
+
+  size_t size() const;
+  size_t capacity() const;
+
+  //! Returns entry i, counting from the oldest entry in the buffer
+  const Entry& operator[]( const size_t i ) const;
+
+  /**
+   * Returns the index of the first entry with t_ >= t, or size() if there
+   * is none.
+   */
+  size_t find( const double t ) const;
+
+  /**
+   * Returns the latest entry with t_ < t, or 0 if there is none. If all
+   * stored entries are later than t, the last dropped entry is returned if
+   * it is earlier than t.
+   */
+  const Entry* find_before( const double t ) const;
+
+  //! Returns the number of entries dropped since the last call to clear()
+  size_t get_num_dropped() const;
+
+  //! Returns the memory allocated by the buffer in bytes
+  size_t get_memory() const;
+
+private:
+  std::vector< Entry > entries_;
+  size_t begin_; //!< position of the oldest entry in entries_
+  size_t size_;  //!< number of valid entries
+  size_t num_dropped_;
+  Entry last_dropped_;
+};
+
+inline TraceBuffer::TraceBuffer()
+  : entries_()
+  , begin_( 0 )
+  , size_( 0 )
+  , num_dropped_( 0 )
+{
+}
+
+inline void
+TraceBuffer::resize( const size_t capacity )
+{
+  std::vector< Entry >( capacity ).swap( entries_ );
+  clear();
+}
+
+inline void
+TraceBuffer::clear()
+{
+  begin_ = 0;
+  size_ = 0;
+  num_dropped_ = 0;
+}
+
+inline void
+TraceBuffer::push_back( const double t, const double Kminus )
+{
+  assert( not entries_.empty() );
+  assert( size_ == 0 or t >= operator[]( size_ - 1 ).t_ );
+
+  if ( size_ == entries_.size() )
+  {
+    last_dropped_ = entries_[ begin_ ];
+    ++num_dropped_;
+    begin_ = ( begin_ + 1 ) % entries_.size();
+    --size_;
+  }
+  Entry& e = entries_[ ( begin_ + size_ ) % entries_.size() ];
+  e.t_ = t;
+  e.Kminus_ = Kminus;
+  ++size_;
+}
+
+inline size_t
+TraceBuffer::size() const
+{
+  return size_;
+}
+
+inline size_t
+TraceBuffer::capacity() const
+{
+  return entries_.size();
+}
+
+inline const TraceBuffer::Entry& TraceBuffer::operator[]( const size_t i ) const
+{
+  assert( i < size_ );
+  const size_t pos = begin_ + i;
+  return entries_[ pos < entries_.size() ? pos : pos - entries_.size() ];
+}
+
+inline size_t
+TraceBuffer::find( const double t ) const
+{
+  size_t lo = 0;
+  size_t hi = size_;
+  while ( lo < hi )
+  {
+    const size_t mid = ( lo + hi ) / 2;
+    if ( operator[]( mid ).t_ < t )
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+  return lo;
+}
+
+inline const TraceBuffer::Entry*
+TraceBuffer::find_before( const double t ) const
+{
+  const size_t i = find( t );
+  if ( i > 0 )
+  {
+    return &operator[]( i - 1 );
+  }
+  return num_dropped_ > 0 and last_dropped_.t_ < t ? &last_dropped_ : 0;
+}
+
+inline size_t
+TraceBuffer::get_num_dropped() const
+{
+  return num_dropped_;
+}
+
+inline size_t
+TraceBuffer::get_memory() const
+{
+  return sizeof( TraceBuffer ) + entries_.capacity() * sizeof( Entry );
+}
+
+} // namespace nest
+
+#endif /* TRACE_BUFFER_H */
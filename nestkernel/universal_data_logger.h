@@ -154,6 +154,16 @@ public:
    */
   void record_data( long );
 
+  /**
+   * Returns true if at least one multimeter is connected, i.e., if
+   * record_data() may read data from the host node.
+   */
+  bool
+  is_connected() const
+  {
+    return not data_loggers_.empty();
+  }
+
   //! Erase all existing data
   void reset();
 
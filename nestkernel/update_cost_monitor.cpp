@@ -0,0 +1,161 @@
+/*
+ *  update_cost_monitor.cpp
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include "update_cost_monitor.h"
+
+// C++ includes:
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <queue>
+
+// Includes from nestkernel:
+#include "kernel_manager.h"
+#include "nest_names.h"
+#include "vp_manager.h"
+
+// Includes from sli:
+#include "arraydatum.h"
+#include "dictutils.h"
+#include "doubledatum.h"
+
+namespace nest
+{
+
+UpdateCostMonitor::UpdateCostMonitor()
+  : stopwatches_()
+  , last_lap_()
+  , node_costs_()
+  , thread_costs_()
+  , imbalance_( 0.0 )
+  , balanced_imbalance_( 0.0 )
+{
+}
+
+void
+UpdateCostMonitor::reset( const thread num_threads )
+{
+  VPManager::assert_single_threaded();
+  stopwatches_.assign( num_threads, Stopwatch() );
+  last_lap_.assign( num_threads, 0.0 );
+  node_costs_.assign( num_threads, std::vector< double >() );
+  thread_costs_.assign( num_threads, 0.0 );
+  imbalance_ = 0.0;
+  balanced_imbalance_ = 0.0;
+}
+
+void
+UpdateCostMonitor::prepare_thread( const thread tid, const size_t num_nodes )
+{
+  assert( static_cast< size_t >( tid ) < node_costs_.size() );
+  if ( node_costs_[ tid ].size() != num_nodes )
+  {
+    node_costs_[ tid ].assign( num_nodes, 0.0 );
+    thread_costs_[ tid ] = 0.0;
+  }
+}
+
+double
+UpdateCostMonitor::get_imbalance_( const std::vector< double >& costs )
+{
+  const double sum = std::accumulate( costs.begin(), costs.end(), 0.0 );
+  if ( sum <= 0.0 )
+  {
+    return 0.0;
+  }
+  return *std::max_element( costs.begin(), costs.end() ) * costs.size() / sum;
+}
+
+double
+UpdateCostMonitor::get_thread_cost_( const thread tid ) const
+{
+  return std::accumulate( node_costs_[ tid ].begin(), node_costs_[ tid ].end(), thread_costs_[ tid ] );
+}
+
+void
+UpdateCostMonitor::gather()
+{
+  VPManager::assert_single_threaded();
+
+  // the cost of each virtual process, the part of it that stays on the
+  // thread and the costs of the nodes that could be moved
+  std::vector< double > local_vp_costs( thread_costs_.size() );
+  std::vector< double > local_fixed_costs( thread_costs_ );
+  std::vector< double > local_node_costs;
+  for ( size_t tid = 0; tid < thread_costs_.size(); ++tid )
+  {
+    local_vp_costs[ tid ] = get_thread_cost_( tid );
+    local_node_costs.insert( local_node_costs.end(), node_costs_[ tid ].begin(), node_costs_[ tid ].end() );
+  }
+
+  std::vector< double > vp_costs;
+  std::vector< double > fixed_costs;
+  std::vector< double > node_costs;
+  std::vector< int > displacements;
+  kernel().mpi_manager.communicate( local_vp_costs, vp_costs, displacements );
+  kernel().mpi_manager.communicate( local_fixed_costs, fixed_costs, displacements );
+  kernel().mpi_manager.communicate( local_node_costs, node_costs, displacements );
+
+  imbalance_ = get_imbalance_( vp_costs );
+
+  // Assign the nodes in order of decreasing cost to the virtual process
+  // with the least cost so far, starting from the costs that stay on
+  // their threads. This greedy scheme is at most 4/3 times worse than
+  // the optimal distribution.
+  std::sort( node_costs.begin(), node_costs.end(), std::greater< double >() );
+  std::priority_queue< double, std::vector< double >, std::greater< double > > loads(
+    fixed_costs.begin(), fixed_costs.end() );
+  for ( std::vector< double >::const_iterator cost = node_costs.begin(); cost != node_costs.end(); ++cost )
+  {
+    const double least = loads.top();
+    loads.pop();
+    loads.push( least + *cost );
+  }
+
+  std::vector< double > balanced_costs;
+  balanced_costs.reserve( loads.size() );
+  while ( not loads.empty() )
+  {
+    balanced_costs.push_back( loads.top() );
+    loads.pop();
+  }
+  balanced_imbalance_ = get_imbalance_( balanced_costs );
+}
+
+void
+UpdateCostMonitor::get_status( DictionaryDatum& d, const Name& name ) const
+{
+  DictionaryDatum cost( new Dictionary );
+
+  std::vector< double > per_thread( thread_costs_.size() );
+  for ( size_t tid = 0; tid < thread_costs_.size(); ++tid )
+  {
+    per_thread[ tid ] = get_thread_cost_( tid );
+  }
+  ( *cost )[ names::per_thread ] = DoubleVectorDatum( new std::vector< double >( per_thread ) );
+  def< double >( cost, names::imbalance, imbalance_ );
+  def< double >( cost, names::balanced_imbalance, balanced_imbalance_ );
+
+  ( *d )[ name ] = cost;
+}
+
+} // namespace nest
@@ -0,0 +1,175 @@
+/*
+ *  update_cost_monitor.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef UPDATE_COST_MONITOR_H
+#define UPDATE_COST_MONITOR_H
+
+// C++ includes:
+#include <cassert>
+#include <vector>
+
+// Includes from libnestutil:
+#include "stopwatch.h"
+
+// Includes from nestkernel:
+#include "nest_types.h"
+
+// Includes from sli:
+#include "dictdatum.h"
+#include "name.h"
+
+namespace nest
+{
+
+/**
+ * Samples the cost of updating each node and estimates how evenly the
+ * update work is distributed across virtual processes.
+ *
+ * Each thread accumulates the update times of its nodes, indexed by
+ * their position in the list of nodes of the thread, and the time of
+ * work that cannot be attributed to single nodes, such as the update
+ * of population engines. The costs are kept across calls to Run until
+ * the monitor is reset or the number of nodes on a thread changes.
+ *
+ * After a run, gather() collects the costs of all virtual processes
+ * and computes the imbalance, i.e., the ratio of the maximal to the
+ * mean cost per virtual process, of the current distribution of nodes
+ * and of a distribution that assigns the nodes, in order of decreasing
+ * cost, to the virtual process with the least cost so far.
+ */
+class UpdateCostMonitor
+{
+public:
+  UpdateCostMonitor();
+
+  /**
+   * Discards all measurements and sets up the monitor for the given
+   * number of threads. Must be called outside of parallel regions.
+   */
+  void reset( const thread num_threads );
+
+  /**
+   * Returns the number of threads the monitor is set up for.
+   */
+  thread get_num_threads() const;
+
+  /**
+   * Prepares thread tid for measuring the cost of num_nodes nodes.
+   * Discards the measurements of the thread if the number of nodes
+   * changed.
+   */
+  void prepare_thread( const thread tid, const size_t num_nodes );
+
+  /**
+   * Restarts the stopwatch of thread tid.
+   */
+  void start( const thread tid );
+
+  /**
+   * Adds the time since the last call to start() or a lap function to
+   * the cost of node lid of thread tid. Taking one time stamp per node
+   * keeps the resolution of the stopwatch from biasing the costs of
+   * nodes that take less than a microsecond to update.
+   */
+  void lap_node( const thread tid, const index lid );
+
+  /**
+   * Adds the time since the last call to start() or a lap function to
+   * the cost of thread tid that is not attributed to single nodes.
+   */
+  void lap_thread( const thread tid );
+
+  /**
+   * Collects the costs of all virtual processes and computes the
+   * imbalance before and after redistribution. Must be called by all MPI
+   * processes outside of parallel regions.
+   */
+  void gather();
+
+  /**
+   * Writes a dictionary with the cost of the local threads (per_thread),
+   * the imbalance of the current distribution of nodes (imbalance) and
+   * of the balanced distribution (balanced_imbalance) to d under the
+   * given name.
+   */
+  void get_status( DictionaryDatum& d, const Name& name ) const;
+
+private:
+  //! Returns the total cost measured on thread tid
+  double get_thread_cost_( const thread tid ) const;
+
+  //! Returns the ratio of maximal to mean cost, zero if nothing was measured
+  static double get_imbalance_( const std::vector< double >& costs );
+
+  //! One stopwatch per thread, running during the update of the thread
+  std::vector< Stopwatch > stopwatches_;
+
+  //! Time of the last lap, per thread
+  std::vector< double > last_lap_;
+
+  //! Update cost of each node, per thread
+  std::vector< std::vector< double > > node_costs_;
+
+  //! Cost of each thread that is not attributed to single nodes
+  std::vector< double > thread_costs_;
+
+  //! Ratio of maximal to mean cost per virtual process
+  double imbalance_;
+
+  //! Imbalance after distributing the nodes by decreasing cost
+  double balanced_imbalance_;
+};
+
+inline thread
+UpdateCostMonitor::get_num_threads() const
+{
+  return stopwatches_.size();
+}
+
+inline void
+UpdateCostMonitor::start( const thread tid )
+{
+  assert( static_cast< size_t >( tid ) < stopwatches_.size() );
+  stopwatches_[ tid ].reset();
+  stopwatches_[ tid ].start();
+  last_lap_[ tid ] = 0.0;
+}
+
+inline void
+UpdateCostMonitor::lap_node( const thread tid, const index lid )
+{
+  const double now = stopwatches_[ tid ].elapsed();
+  node_costs_[ tid ][ lid ] += now - last_lap_[ tid ];
+  last_lap_[ tid ] = now;
+}
+
+inline void
+UpdateCostMonitor::lap_thread( const thread tid )
+{
+  const double now = stopwatches_[ tid ].elapsed();
+  thread_costs_[ tid ] += now - last_lap_[ tid ];
+  last_lap_[ tid ] = now;
+}
+
+} // namespace nest
+
+#endif /* UPDATE_COST_MONITOR_H */
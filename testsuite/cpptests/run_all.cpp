@@ -29,3 +29,4 @@
 #include "test_target_fields.h"
 #include "test_block_vector.h"
 #include "test_streamers.h"
+#include "test_dormand_prince.h"
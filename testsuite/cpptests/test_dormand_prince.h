@@ -0,0 +1,167 @@
+/*
+ *  test_dormand_prince.h
+ *
+ *  This file is part of NEST.
+ *
+ *  Copyright (C) 2004 The NEST Initiative
+ *
+ *  NEST is free software: you can redistribute it and/or modify
+ *  it under the terms of the GNU General Public License as published by
+ *  the Free Software Foundation, either version 2 of the License, or
+ *  (at your option) any later version.
+ *
+ *  NEST is distributed in the hope that it will be useful,
+ *  but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *  GNU General Public License for more details.
+ *
+ *  You should have received a copy of the GNU General Public License
+ *  along with NEST.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#ifndef TEST_DORMAND_PRINCE_H
+#define TEST_DORMAND_PRINCE_H
+
+#define BOOST_TEST_DYN_LINK
+#include <boost/test/unit_test.hpp>
+
+// C++ includes:
+#include <cmath>
+#include <vector>
+
+// Includes from nestkernel:
+#include "dormand_prince.h"
+
+namespace nest
+{
+
+/**
+ * Damped harmonic oscillator x'' = -omega^2 x - gamma x'.
+ */
+struct DampedOscillator
+{
+  double omega;
+  double gamma;
+
+  void operator()( const double y[], double dydt[] ) const
+  {
+    dydt[ 0 ] = y[ 1 ];
+    dydt[ 1 ] = -omega * omega * y[ 0 ] - gamma * y[ 1 ];
+  }
+};
+
+/**
+ * Damped harmonic oscillators with individual parameters in the layout
+ * of BatchDormandPrince.
+ */
+struct DampedOscillators
+{
+  const double* omega;
+  const double* gamma;
+
+  void operator()( const double y[], double dydt[], const size_t n ) const
+  {
+    for ( size_t i = 0; i < n; ++i )
+    {
+      dydt[ i ] = y[ n + i ];
+      dydt[ n + i ] = -omega[ i ] * omega[ i ] * y[ i ] - gamma[ i ] * y[ n + i ];
+    }
+  }
+};
+
+/**
+ * Right-hand side that cannot be evaluated.
+ */
+struct Diverging
+{
+  void operator()( const double y[], double dydt[] ) const
+  {
+    dydt[ 0 ] = std::sqrt( -1.0 - y[ 0 ] * y[ 0 ] );
+  }
+};
+
+BOOST_AUTO_TEST_SUITE( test_dormand_prince )
+
+/**
+ * Integrates an undamped oscillator over one period in four calls and
+ * compares to the exact solution.
+ */
+BOOST_AUTO_TEST_CASE( test_accuracy )
+{
+  const DampedOscillator f = { 2.0 * M_PI, 0.0 };
+  DormandPrince< 2 > integrator( 1e-8, 0.0 );
+
+  double y[ 2 ] = { 1.0, 0.0 };
+  double h = 0.25;
+  for ( int step = 0; step < 4; ++step )
+  {
+    BOOST_REQUIRE( integrator.integrate( f, 0.25, h, y ) );
+  }
+
+  BOOST_REQUIRE_SMALL( y[ 0 ] - 1.0, 1e-6 );
+  BOOST_REQUIRE_SMALL( y[ 1 ], 1e-5 );
+
+  // the step size adapted to the dynamics
+  BOOST_REQUIRE( h < 0.25 );
+}
+
+/**
+ * Checks that each system in a batch takes the same steps as if it were
+ * integrated alone.
+ */
+BOOST_AUTO_TEST_CASE( test_batch_equals_single )
+{
+  const size_t n = 5;
+  const double omega[ n ] = { 1.0, 3.0, 10.0, 30.0, 100.0 };
+  const double gamma[ n ] = { 0.0, 0.5, 1.0, 2.0, 50.0 };
+  const DampedOscillators f_batch = { omega, gamma };
+  BatchDormandPrince< 2 > batch( 1e-6, 1e-6 );
+
+  std::vector< double > y_batch( 2 * n );
+  std::vector< double > h_batch( n, 0.1 );
+  std::vector< double > y_single( 2 * n );
+  std::vector< double > h_single( n, 0.1 );
+  for ( size_t i = 0; i < n; ++i )
+  {
+    y_batch[ i ] = y_single[ 2 * i ] = 1.0;
+    y_batch[ n + i ] = y_single[ 2 * i + 1 ] = 0.0;
+  }
+
+  for ( int step = 0; step < 50; ++step )
+  {
+    BOOST_REQUIRE( batch.integrate( f_batch, 0.1, &h_batch[ 0 ], &y_batch[ 0 ], n ) );
+    for ( size_t i = 0; i < n; ++i )
+    {
+      const DampedOscillator f = { omega[ i ], gamma[ i ] };
+      DormandPrince< 2 > single( 1e-6, 1e-6 );
+      BOOST_REQUIRE( single.integrate( f, 0.1, h_single[ i ], &y_single[ 2 * i ] ) );
+    }
+  }
+
+  for ( size_t i = 0; i < n; ++i )
+  {
+    BOOST_REQUIRE_CLOSE( y_batch[ i ], y_single[ 2 * i ], 1e-10 );
+    BOOST_REQUIRE_CLOSE( y_batch[ n + i ], y_single[ 2 * i + 1 ], 1e-10 );
+    BOOST_REQUIRE_CLOSE( h_batch[ i ], h_single[ i ], 1e-10 );
+  }
+}
+
+/**
+ * Checks that integration fails instead of looping forever if the
+ * error cannot be controlled.
+ */
+BOOST_AUTO_TEST_CASE( test_failure )
+{
+  const Diverging f = Diverging();
+  DormandPrince< 1 > integrator( 1e-3, 0.0 );
+
+  double y[ 1 ] = { 0.0 };
+  double h = 0.1;
+  BOOST_REQUIRE( not integrator.integrate( f, 0.1, h, y ) );
+}
+
+BOOST_AUTO_TEST_SUITE_END()
+}
+
+#endif /* TEST_DORMAND_PRINCE_H */